@@ -46,6 +46,7 @@ public class MounteaAdvancedInventorySystem : ModuleRules
 				
 				"Projects",
 				"UMG",
+				"AssetRegistry",
 				
 				"NetCore",
 				
@@ -17,11 +17,14 @@
 #include "Definitions/MounteaAdvancedInventoryLoadoutConfig.h"
 #include "Definitions/MounteaAdvancedInventoryLoadoutItem.h"
 #include "Definitions/MounteaInventoryItemTemplate.h"
+#include "Engine/AssetManager.h"
 #include "Interfaces/Equipment/MounteaAdvancedEquipmentInterface.h"
 #include "Interfaces/Inventory/MounteaAdvancedInventoryInterface.h"
 #include "Logs/MounteaAdvancedInventoryLog.h"
+#include "Net/UnrealNetwork.h"
 #include "Statics/MounteaEquipmentStatics.h"
 #include "Statics/MounteaInventoryStatics.h"
+#include "Statics/MounteaLoadoutStatics.h"
 
 using FResolvedLoadoutItem = TPair<UMounteaAdvancedInventoryLoadoutItem*, FMounteaInventoryItem>;
 
@@ -53,21 +56,52 @@ static void LogFailedLoadoutItems(const TArray<UMounteaAdvancedInventoryLoadoutI
 }
 
 static void LoadItemsToInventory(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Inventory, const TArray<UMounteaAdvancedInventoryLoadoutItem*>& SourceItems,
-	TArray<UMounteaAdvancedInventoryLoadoutItem*>& OutLoadedItems, TArray<UMounteaAdvancedInventoryLoadoutItem*>& OutFailedItems)
+	const TArray<int32>& Quantities, TArray<UMounteaAdvancedInventoryLoadoutItem*>& OutLoadedItems, TArray<UMounteaAdvancedInventoryLoadoutItem*>& OutFailedItems)
 {
 	OutLoadedItems.Reserve(SourceItems.Num());
 	OutFailedItems.Reserve(SourceItems.Num());
 
-	Algo::ForEach(SourceItems, [&Inventory, &OutLoadedItems, &OutFailedItems](UMounteaAdvancedInventoryLoadoutItem* Item)
+	TArray<TPair<UMounteaAdvancedInventoryLoadoutItem*, int32>> validItems;
+	TArray<FInventoryTransactionOperation> operations;
+	validItems.Reserve(SourceItems.Num());
+	operations.Reserve(SourceItems.Num());
+
+	for (int32 itemIndex = 0; itemIndex < SourceItems.Num(); ++itemIndex)
+	{
+		UMounteaAdvancedInventoryLoadoutItem* item = SourceItems[itemIndex];
+		if (!IsValid(item) || !IsValid(item->ItemTemplate) || !Quantities.IsValidIndex(itemIndex))
+		{
+			OutFailedItems.Add(item);
+			continue;
+		}
+
+		validItems.Emplace(item, Quantities[itemIndex]);
+		operations.Add(FInventoryTransactionOperation::MakeAdd(
+			FMounteaInventoryItem(item->ItemTemplate, Quantities[itemIndex], item->BaseDurability, nullptr)));
+	}
+
+	if (operations.IsEmpty())
+		return;
+
+	// Whole loadout goes in as single mutation, so it replicates and notifies once
+	if (UMounteaInventoryStatics::ExecuteTransaction(Inventory, operations))
 	{
-		const bool bAdded = IsValid(Item) && UMounteaInventoryStatics::AddItemFromTemplate(Inventory, Item->ItemTemplate, Item->BaseQuantity, Item->BaseDurability);
+		Algo::Transform(validItems, OutLoadedItems, [](const TPair<UMounteaAdvancedInventoryLoadoutItem*, int32>& ItemPair) { return ItemPair.Key; });
+		return;
+	}
+
+	// Transaction is all or nothing, grant items one by one so those which fit are still added
+	Algo::ForEach(validItems, [&Inventory, &OutLoadedItems, &OutFailedItems](const TPair<UMounteaAdvancedInventoryLoadoutItem*, int32>& ItemPair)
+	{
+		UMounteaAdvancedInventoryLoadoutItem* item = ItemPair.Key;
+		const bool bAdded = UMounteaInventoryStatics::AddItemFromTemplate(Inventory, item->ItemTemplate, ItemPair.Value, item->BaseDurability);
 		if (bAdded)
 		{
-			OutLoadedItems.Add(Item);
+			OutLoadedItems.Add(item);
 			return;
 		}
 
-		OutFailedItems.Add(Item);
+		OutFailedItems.Add(item);
 	});
 }
 
@@ -80,6 +114,24 @@ static bool IsLoadoutItemEquippable(const UMounteaAdvancedInventoryLoadoutItem*
 	return IsValid(itemTemplate) && itemTemplate->EquipmentItemType.IsValid() && !itemTemplate->AttachmentSlots.IsEmpty();
 }
 
+static TArray<FSoftObjectPath> CollectSpawnClassesToLoad(const TArray<UMounteaAdvancedInventoryLoadoutItem*>& Items)
+{
+	TArray<FSoftObjectPath> spawnClassPaths;
+	spawnClassPaths.Reserve(Items.Num());
+
+	Algo::ForEach(Items, [&spawnClassPaths](const UMounteaAdvancedInventoryLoadoutItem* Item)
+	{
+		if (!IsLoadoutItemEquippable(Item))
+			return;
+
+		const TSoftClassPtr<AActor>& spawnActor = Item->ItemTemplate->SpawnActor;
+		if (!spawnActor.IsNull() && !spawnActor.Get())
+			spawnClassPaths.AddUnique(spawnActor.ToSoftObjectPath());
+	});
+
+	return spawnClassPaths;
+}
+
 static TArray<UMounteaAdvancedInventoryLoadoutItem*> CollectItemsToEquip(const TArray<UMounteaAdvancedInventoryLoadoutItem*>& LoadedItems)
 {
 	TArray<UMounteaAdvancedInventoryLoadoutItem*> itemsToEquip;
@@ -135,7 +187,10 @@ static void EquipResolvedInventoryItems(const TScriptInterface<IMounteaAdvancedE
 }
 
 UMounteaAdvancedInventoryLoadoutComponent::UMounteaAdvancedInventoryLoadoutComponent() :
-	bAutoLoad(true)
+	bAutoLoad(true),
+	bUseFixedRandomSeed(false),
+	FixedRandomSeed(0),
+	ActiveRandomSeed(0)
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = false;
@@ -157,8 +212,22 @@ bool UMounteaAdvancedInventoryLoadoutComponent::LoadLoadout_Implementation()
 		Server_LoadLoadout();
 		return true;
 	}
+
+	// Seed is picked on authority only, clients receive results, not the dice
+	return Execute_LoadLoadoutWithSeed(this, bUseFixedRandomSeed ? FixedRandomSeed : FMath::Rand());
+}
+
+bool UMounteaAdvancedInventoryLoadoutComponent::LoadLoadoutWithSeed_Implementation(const int32 RandomSeed)
+{
+	// Clients never choose the seed, server picks its own
+	if (!GetOwner()->HasAuthority())
+	{
+		LOG_WARNING(TEXT("[LoadLoadout] Random seed can only be set on authority, requesting regular load instead."))
+		Server_LoadLoadout();
+		return true;
+	}
 	
-	if (!IsValid(LoadoutConfiguration.LoadSynchronous()))
+	if (LoadoutConfiguration.IsNull())
 	{
 		LOG_WARNING(TEXT("[LoadLoadout] Loadout configuration is invalid!"))
 		return false;
@@ -168,6 +237,72 @@ bool UMounteaAdvancedInventoryLoadoutComponent::LoadLoadout_Implementation()
 		LOG_WARNING(TEXT("[LoadLoadout] Inventory is invalid!"))
 		return false;
 	}
+
+	// Loadout is already being loaded, it gets applied once loading finishes
+	if (LoadoutLoadHandle.IsValid() && LoadoutLoadHandle->IsLoadingInProgress())
+		return true;
+
+	ActiveRandomSeed = RandomSeed;
+
+	if (!IsValid(LoadoutConfiguration.Get()))
+	{
+		LoadoutLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			LoadoutConfiguration.ToSoftObjectPath(),
+			FStreamableDelegate::CreateUObject(this, &UMounteaAdvancedInventoryLoadoutComponent::OnLoadoutConfigurationLoaded));
+		return LoadoutLoadHandle.IsValid();
+	}
+
+	return RequestLoadoutAssets();
+}
+
+bool UMounteaAdvancedInventoryLoadoutComponent::RequestLoadoutAssets()
+{
+	const UMounteaAdvancedInventoryLoadoutConfig* loadoutConfig = LoadoutConfiguration.Get();
+	if (!IsValid(loadoutConfig))
+	{
+		LOG_WARNING(TEXT("[LoadLoadout] Loadout configuration is invalid!"))
+		LoadoutLoadHandle.Reset();
+		return false;
+	}
+
+	TArray<FSoftObjectPath> assetsToLoad;
+	if (IsValid(RelatedEquipment.GetObject()))
+		assetsToLoad = CollectSpawnClassesToLoad(loadoutConfig->Items);
+
+	if (assetsToLoad.IsEmpty())
+	{
+		const bool bResult = ApplyLoadout();
+		LoadoutLoadHandle.Reset();
+		return bResult;
+	}
+
+	// Configuration is part of the request so it stays loaded with the classes
+	assetsToLoad.Add(LoadoutConfiguration.ToSoftObjectPath());
+	LoadoutLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		assetsToLoad,
+		FStreamableDelegate::CreateUObject(this, &UMounteaAdvancedInventoryLoadoutComponent::OnLoadoutAssetsLoaded));
+	return LoadoutLoadHandle.IsValid();
+}
+
+void UMounteaAdvancedInventoryLoadoutComponent::OnLoadoutConfigurationLoaded()
+{
+	RequestLoadoutAssets();
+}
+
+void UMounteaAdvancedInventoryLoadoutComponent::OnLoadoutAssetsLoaded()
+{
+	ApplyLoadout();
+	LoadoutLoadHandle.Reset();
+}
+
+bool UMounteaAdvancedInventoryLoadoutComponent::ApplyLoadout()
+{
+	if (!IsValid(RelatedInventory.GetObject()))
+	{
+		LOG_WARNING(TEXT("[LoadLoadout] Inventory is invalid!"))
+		return false;
+	}
+
 	const TArray<UMounteaAdvancedInventoryLoadoutItem*> items = Execute_GetLoadoutItems(this);
 	if (items.IsEmpty())
 	{
@@ -178,7 +313,9 @@ bool UMounteaAdvancedInventoryLoadoutComponent::LoadLoadout_Implementation()
 	TArray<UMounteaAdvancedInventoryLoadoutItem*> loadedItems;
 	TArray<UMounteaAdvancedInventoryLoadoutItem*> failedItems;
 
-	LoadItemsToInventory(RelatedInventory, items, loadedItems, failedItems);
+	// Quantities are resolved up front in loadout order, so the result depends on seed only
+	const TArray<int32> quantities = UMounteaLoadoutStatics::ResolveLoadoutQuantities(items, ActiveRandomSeed);
+	LoadItemsToInventory(RelatedInventory, items, quantities, loadedItems, failedItems);
 	LogFailedLoadoutItems(
 		failedItems,
 		TEXT("[LoadLoadout] Failed to load invalid/null item from Loadout!"),
@@ -248,3 +385,20 @@ void UMounteaAdvancedInventoryLoadoutComponent::BeginPlay()
 		Execute_LoadLoadout(this);
 }
 
+void UMounteaAdvancedInventoryLoadoutComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (LoadoutLoadHandle.IsValid())
+	{
+		LoadoutLoadHandle->CancelHandle();
+		LoadoutLoadHandle.Reset();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UMounteaAdvancedInventoryLoadoutComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(UMounteaAdvancedInventoryLoadoutComponent, ActiveRandomSeed);
+}
+
@@ -63,20 +63,28 @@ void UMounteaAttachmentContainerComponent::BeginPlay()
 			AttachmentSlot->BeginPlay();
 		}
 	});
+
+	MarkSlotIndicesDirty();
+	SyncReplicatedSlots();
+}
+
+void UMounteaAttachmentContainerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+	for (const auto& replicatedSlot : ReplicatedSlots)
+		RemoveReplicatedSubObject(replicatedSlot);
+#endif
+	ReplicatedSlots.Reset();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 bool UMounteaAttachmentContainerComponent::ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch,
 	FReplicationFlags* RepFlags)
 {
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-	bool wroteSomething = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
-    
-	for (auto& Slot : AttachmentSlots)
-	{
-		if (IsValid(Slot))
-			AddReplicatedSubObject(Slot);
-	}
-	return wroteSomething;
+	// Slots are registered in SyncReplicatedSlots, registered subobject list replicates them
+	return Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
 #else
 	bool wroteSomething = true;
 
@@ -103,41 +111,24 @@ void UMounteaAttachmentContainerComponent::SetDefaultAttachmentTargetComponent_I
 
 bool UMounteaAttachmentContainerComponent::IsValidSlot_Implementation(const FName& SlotId) const
 {
-	const auto foundSlot = AttachmentSlots.FindByPredicate([SlotId](const TObjectPtr<UMounteaAdvancedAttachmentSlot>& Slot)
-	{
-		return Slot && Slot->SlotName == SlotId;
-	});
-
-	return foundSlot && *foundSlot && (*foundSlot)->IsSlotValid();
+	const UMounteaAdvancedAttachmentSlot* foundSlot = FindSlotByName(SlotId);
+	return foundSlot && foundSlot->IsSlotValid();
 }
 
 UMounteaAdvancedAttachmentSlot* UMounteaAttachmentContainerComponent::GetSlot_Implementation(const FName& SlotId) const
 {
-	const auto foundSlot = AttachmentSlots.FindByPredicate([SlotId](const TObjectPtr<UMounteaAdvancedAttachmentSlot>& Slot)
-	{
-		return Slot && Slot->SlotName == SlotId;
-	});
-
-	return foundSlot ? foundSlot->Get() : nullptr;
+	return FindSlotByName(SlotId);
 }
 
 bool UMounteaAttachmentContainerComponent::IsSlotOccupied_Implementation(const FName& SlotId) const
 {
-	const auto foundSlotPtr = AttachmentSlots.FindByPredicate([SlotId](const UMounteaAdvancedAttachmentSlot* Slot) 
-	{
-		return Slot && Slot->SlotName == SlotId;
-	});
-	const UMounteaAdvancedAttachmentSlot* foundSlot = foundSlotPtr ? *foundSlotPtr : nullptr;
+	const UMounteaAdvancedAttachmentSlot* foundSlot = FindSlotByName(SlotId);
 	return foundSlot && foundSlot->IsOccupied();
 }
 
 bool UMounteaAttachmentContainerComponent::DisableSlot_Implementation(const FName& SlotId)
 {
-	auto foundSlotPtr = AttachmentSlots.FindByPredicate([SlotId](const UMounteaAdvancedAttachmentSlot* Slot) 
-	{
-		return Slot && Slot->SlotName == SlotId;
-	});
-	UMounteaAdvancedAttachmentSlot* foundSlot = foundSlotPtr ? *foundSlotPtr : nullptr;
+	UMounteaAdvancedAttachmentSlot* foundSlot = FindSlotByName(SlotId);
 	if (!foundSlot)
 		return false;
 
@@ -171,21 +162,13 @@ bool UMounteaAttachmentContainerComponent::TryAttachInternal(const FName& SlotId
 {
 	if (!Attachment) return false;
 
-	auto foundSlot = AttachmentSlots.FindByPredicate([SlotId](const UMounteaAdvancedAttachmentSlot* Slot)
-	{
-		return Slot && Slot->SlotName == SlotId;
-	});
-    
-	return foundSlot && (*foundSlot)->Attach(Attachment);
+	UMounteaAdvancedAttachmentSlot* foundSlot = FindSlotByName(SlotId);
+	return foundSlot && foundSlot->Attach(Attachment);
 }
 
 bool UMounteaAttachmentContainerComponent::TryDetach_Implementation(const FName& SlotId)
 {
-	auto foundSlotPtr = AttachmentSlots.FindByPredicate([SlotId](const UMounteaAdvancedAttachmentSlot* Slot)
-	{
-		return Slot && Slot->SlotName == SlotId;
-	});
-	UMounteaAdvancedAttachmentSlot* foundSlot = foundSlotPtr ? *foundSlotPtr : nullptr;
+	UMounteaAdvancedAttachmentSlot* foundSlot = FindSlotByName(SlotId);
 	if (!foundSlot)
 		return false;
 
@@ -208,11 +191,7 @@ bool UMounteaAttachmentContainerComponent::ForceAttach_Implementation(const FNam
 	if (!Attachment)
 		return false;
 
-	auto foundSlotPtr = AttachmentSlots.FindByPredicate([SlotId](const UMounteaAdvancedAttachmentSlot* Slot)
-	{
-		return Slot && Slot->SlotName == SlotId;
-	});
-	UMounteaAdvancedAttachmentSlot* foundSlot = foundSlotPtr ? *foundSlotPtr : nullptr;
+	UMounteaAdvancedAttachmentSlot* foundSlot = FindSlotByName(SlotId);
 	if (!foundSlot)
 		return false;
 
@@ -223,11 +202,7 @@ bool UMounteaAttachmentContainerComponent::ForceAttach_Implementation(const FNam
 
 bool UMounteaAttachmentContainerComponent::ForceDetach_Implementation(const FName& SlotId)
 {
-	auto foundSlotPtr = AttachmentSlots.FindByPredicate([SlotId](const UMounteaAdvancedAttachmentSlot* Slot)
-	{
-		return Slot && Slot->SlotName == SlotId;
-	});
-	UMounteaAdvancedAttachmentSlot* foundSlot = foundSlotPtr ? *foundSlotPtr : nullptr;
+	UMounteaAdvancedAttachmentSlot* foundSlot = FindSlotByName(SlotId);
 	if (!foundSlot)
 		return false;
 
@@ -238,17 +213,23 @@ bool UMounteaAttachmentContainerComponent::ForceDetach_Implementation(const FNam
 
 FName UMounteaAttachmentContainerComponent::FindFirstFreeSlotWithTags_Implementation(const FGameplayTagContainer& RequiredTags) const
 {
-	const auto* found = Algo::FindByPredicate(AttachmentSlots,
-		[&](const UMounteaAdvancedAttachmentSlot* slot)
-		{
-			return slot != nullptr
-				&& !slot->IsOccupied()
-				&& slot->CanAttach()
-				&& slot->MatchesTags(RequiredTags, true)
-				&& !UMounteaEquipmentStatics::IsSlotBlockedByCurrentAttachments(this, slot, true);
-		});
+	// Blocking of all slots is resolved at most once, and only if any slot matches
+	TBitArray<> blockedSlots;
+	const TArray<UMounteaAdvancedAttachmentSlot*> attachmentSlots = Execute_GetAttachmentSlots(this);
+	for (int32 slotIndex = 0; slotIndex < attachmentSlots.Num(); ++slotIndex)
+	{
+		const UMounteaAdvancedAttachmentSlot* slot = attachmentSlots[slotIndex];
+		if (slot == nullptr || slot->IsOccupied() || !slot->CanAttach() || !slot->MatchesTags(RequiredTags, true))
+			continue;
+
+		if (blockedSlots.Num() != attachmentSlots.Num())
+			blockedSlots = UMounteaEquipmentStatics::GetSlotsBlockedByCurrentAttachments(this, true);
+
+		if (!blockedSlots.IsValidIndex(slotIndex) || !blockedSlots[slotIndex])
+			return slot->SlotName;
+	}
 
-	return found ? (*found)->SlotName : NAME_None;
+	return NAME_None;
 }
 
 FName UMounteaAttachmentContainerComponent::GetSlotIdForAttachable_Implementation(const UMounteaAttachableComponent* Attachable) const
@@ -293,6 +274,111 @@ void UMounteaAttachmentContainerComponent::ApplyParentContainer()
 	}
 }
 
+bool UMounteaAttachmentContainerComponent::AddAttachmentSlot(UMounteaAdvancedAttachmentSlot* NewSlot)
+{
+	if (!IsValid(NewSlot) || !GetOwner() || !GetOwner()->HasAuthority())
+		return false;
+
+	if (FindSlotByName(NewSlot->SlotName) != nullptr)
+	{
+		LOG_WARNING(TEXT("[AddAttachmentSlot] Slot '%s' already exists!"), *NewSlot->SlotName.ToString())
+		return false;
+	}
+
+	AttachmentSlots.Add(NewSlot);
+	if (HasBegunPlay())
+	{
+		NewSlot->InitializeAttachmentSlot(this);
+		NewSlot->BeginPlay();
+	}
+
+	MarkSlotIndicesDirty();
+	SyncReplicatedSlots();
+	return true;
+}
+
+bool UMounteaAttachmentContainerComponent::RemoveAttachmentSlot(const FName& SlotId)
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority())
+		return false;
+
+	UMounteaAdvancedAttachmentSlot* foundSlot = FindSlotByName(SlotId);
+	if (!foundSlot)
+		return false;
+
+	if (foundSlot->IsOccupied())
+		foundSlot->Detach();
+
+	AttachmentSlots.Remove(foundSlot);
+	MarkSlotIndicesDirty();
+	SyncReplicatedSlots();
+	return true;
+}
+
+void UMounteaAttachmentContainerComponent::SyncReplicatedSlots()
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority())
+		return;
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+	for (int32 slotIndex = ReplicatedSlots.Num() - 1; slotIndex >= 0; --slotIndex)
+	{
+		UMounteaAdvancedAttachmentSlot* replicatedSlot = ReplicatedSlots[slotIndex];
+		if (AttachmentSlots.Contains(replicatedSlot))
+			continue;
+
+		if (replicatedSlot)
+			RemoveReplicatedSubObject(replicatedSlot);
+		ReplicatedSlots.RemoveAtSwap(slotIndex);
+	}
+
+	for (const auto& attachmentSlot : AttachmentSlots)
+	{
+		if (!IsValid(attachmentSlot) || ReplicatedSlots.Contains(attachmentSlot))
+			continue;
+
+		AddReplicatedSubObject(attachmentSlot);
+		ReplicatedSlots.Add(attachmentSlot);
+	}
+#endif
+}
+
+void UMounteaAttachmentContainerComponent::OnRep_AttachmentSlots()
+{
+	MarkSlotIndicesDirty();
+}
+
+void UMounteaAttachmentContainerComponent::MarkSlotIndicesDirty()
+{
+	bSlotIndicesDirty = true;
+}
+
+void UMounteaAttachmentContainerComponent::RebuildSlotIndices() const
+{
+	SlotIndices.Reset();
+	SlotIndices.Reserve(AttachmentSlots.Num());
+
+	for (int32 slotIndex = 0; slotIndex < AttachmentSlots.Num(); ++slotIndex)
+	{
+		const UMounteaAdvancedAttachmentSlot* slot = AttachmentSlots[slotIndex];
+		if (IsValid(slot) && !SlotIndices.Contains(slot->SlotName))
+			SlotIndices.Add(slot->SlotName, slotIndex);
+	}
+
+	IndexedSlotsNum = AttachmentSlots.Num();
+	bSlotIndicesDirty = false;
+}
+
+UMounteaAdvancedAttachmentSlot* UMounteaAttachmentContainerComponent::FindSlotByName(const FName& SlotId) const
+{
+	// Count check catches slots added or removed directly through AttachmentSlots
+	if (bSlotIndicesDirty || IndexedSlotsNum != AttachmentSlots.Num())
+		RebuildSlotIndices();
+
+	const int32* slotIndex = SlotIndices.Find(SlotId);
+	return slotIndex && AttachmentSlots.IsValidIndex(*slotIndex) ? AttachmentSlots[*slotIndex].Get() : nullptr;
+}
+
 TArray<FName> UMounteaAttachmentContainerComponent::GetAvailableTargetNames() const
 {
 	const AActor* ownerActor = UMounteaInventorySystemStatics::GetOwningActor(this);
@@ -323,12 +409,16 @@ void UMounteaAttachmentContainerComponent::PostEditChangeProperty(FPropertyChang
 	if (PropertyName == GET_MEMBER_NAME_CHECKED(UMounteaAttachmentContainerComponent, AttachmentSlots))
 	{
 		ApplyParentContainer();
+		MarkSlotIndicesDirty();
 	}
 }
 
 void UMounteaAttachmentContainerComponent::PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeChainProperty(PropertyChangedEvent);
+
+	// Slots might have been renamed in place
+	MarkSlotIndicesDirty();
 	
 	const FName PropertyName = (PropertyChangedEvent.Property != nullptr) ? PropertyChangedEvent.Property->GetFName() : NAME_None;
 	if (PropertyName == GET_MEMBER_NAME_CHECKED(UMounteaAttachmentContainerComponent, AttachmentSlots))
@@ -15,10 +15,15 @@
 #include "Net/UnrealNetwork.h"
 #include "Definitions/MounteaCraftingBaseDataTypes.h"
 #include "Definitions/MounteaCraftingBaseEnums.h"
+#include "Definitions/MounteaInventoryItem.h"
+#include "Definitions/MounteaRecipeIngredient.h"
+#include "Definitions/MounteaRecipeIngredientsList.h"
 #include "Definitions/MounteaRecipeTemplate.h"
+#include "Engine/AssetManager.h"
 #include "Interfaces/Crafting/MounteaAdvancedCraftingStationInterface.h"
 #include "Interfaces/Inventory/MounteaAdvancedInventoryInterface.h"
 #include "Logs/MounteaAdvancedInventoryLog.h"
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
 #include "Statics/MounteaCraftingStatics.h"
 
 UMounteaCraftingParticipantComponent::UMounteaCraftingParticipantComponent()
@@ -40,9 +45,26 @@ void UMounteaCraftingParticipantComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	RecipesChangedHandle = FMounteaAdvancedInventorySettingsCache::OnRecipesChanged().AddUObject(this, &UMounteaCraftingParticipantComponent::OnAllowedRecipesChanged);
+	RebuildKnownRecipeTemplates();
 	InitializeInventoryAndEquipment();
 }
 
+void UMounteaCraftingParticipantComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (const TSharedPtr<FStreamableHandle>& loadHandle : IngredientLoadHandles)
+	{
+		if (loadHandle.IsValid())
+			loadHandle->CancelHandle();
+	}
+	IngredientLoadHandles.Reset();
+
+	FMounteaAdvancedInventorySettingsCache::OnRecipesChanged().Remove(RecipesChangedHandle);
+	RecipesChangedHandle.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UMounteaCraftingParticipantComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -53,12 +75,29 @@ void UMounteaCraftingParticipantComponent::GetLifetimeReplicatedProps(TArray<FLi
 void UMounteaCraftingParticipantComponent::OnRep_KnownRecipes()
 {
 	// KnownRecipes updated by replication; delegates fire via PostRecipeLearned_Client / PostRecipeForgotten_Client.
+	RebuildKnownRecipeTemplates();
+	RebuildCraftabilityCache();
 }
 
 void UMounteaCraftingParticipantComponent::OnRep_CraftingStation()
 {
 }
 
+void UMounteaCraftingParticipantComponent::OnParentInventoryItemAdded(const FMounteaInventoryItem& AddedItem)
+{
+	ApplyIngredientQuantityDelta(AddedItem, AddedItem.GetQuantity());
+}
+
+void UMounteaCraftingParticipantComponent::OnParentInventoryItemRemoved(const FMounteaInventoryItem& RemovedItem)
+{
+	ApplyIngredientQuantityDelta(RemovedItem, -RemovedItem.GetQuantity());
+}
+
+void UMounteaCraftingParticipantComponent::OnParentInventoryItemQuantityChanged(const FMounteaInventoryItem& Item, int32 OldQuantity, int32 NewQuantity)
+{
+	ApplyIngredientQuantityDelta(Item, NewQuantity - OldQuantity);
+}
+
 void UMounteaCraftingParticipantComponent::InitializeInventoryAndEquipment()
 {
 	auto inventoryComponent = GetOwner()->FindComponentByInterface(UMounteaAdvancedInventoryInterface::StaticClass());
@@ -73,12 +112,22 @@ void UMounteaCraftingParticipantComponent::InitializeInventoryAndEquipment()
 
 TArray<UMounteaRecipeTemplate*> UMounteaCraftingParticipantComponent::GetKnownRecipes_Implementation() const
 {
-	return ResolveKnownRecipeTemplates(KnownRecipes);
+	TArray<UMounteaRecipeTemplate*> result;
+	result.Reserve(KnownRecipeTemplates.Num());
+
+	// Preserve learning order of KnownRecipes
+	for (const FGuid& knownRecipe : KnownRecipes)
+	{
+		if (const TObjectPtr<UMounteaRecipeTemplate>* recipeTemplate = KnownRecipeTemplates.Find(knownRecipe))
+			result.Add(*recipeTemplate);
+	}
+
+	return result;
 }
 
 TArray<UMounteaRecipeTemplate*> UMounteaCraftingParticipantComponent::GetRecipes_Implementation(const FGameplayTag& CraftingStationType) const
 {
-	const TArray<UMounteaRecipeTemplate*> knownRecipes = ResolveKnownRecipeTemplates(KnownRecipes);
+	const TArray<UMounteaRecipeTemplate*> knownRecipes = Execute_GetKnownRecipes(this);
 	if (knownRecipes.Num() == 0)
 		return TArray<UMounteaRecipeTemplate*>();
 
@@ -99,17 +148,8 @@ TArray<UMounteaRecipeTemplate*> UMounteaCraftingParticipantComponent::GetRecipes
 
 UMounteaRecipeTemplate* UMounteaCraftingParticipantComponent::GetRecipe_Implementation(const FGuid& RecipeGuid) const
 {
-	if (!KnownRecipes.Contains(RecipeGuid))
-		return nullptr;
-
-	const TArray<UMounteaRecipeTemplate*> knownRecipes = ResolveKnownRecipeTemplates(KnownRecipes);
-	UMounteaRecipeTemplate* const* foundRecipe = knownRecipes.FindByPredicate(
-		[&RecipeGuid](const UMounteaRecipeTemplate* recipe)
-		{
-			return IsValid(recipe) && recipe->RecipeGuid == RecipeGuid;
-		});
-
-	return foundRecipe != nullptr ? *foundRecipe : nullptr;
+	const TObjectPtr<UMounteaRecipeTemplate>* foundRecipe = KnownRecipeTemplates.Find(RecipeGuid);
+	return foundRecipe != nullptr ? foundRecipe->Get() : nullptr;
 }
 
 bool UMounteaCraftingParticipantComponent::IsRecipeKnown_Implementation(UMounteaRecipeTemplate* RecipeTemplate) const
@@ -129,6 +169,8 @@ bool UMounteaCraftingParticipantComponent::LearnRecipe_Implementation(UMounteaRe
 	}
 
 	KnownRecipes.Add(RecipeTemplate->RecipeGuid);
+	KnownRecipeTemplates.Add(RecipeTemplate->RecipeGuid, RecipeTemplate);
+	RebuildCraftabilityCache();
 	PostRecipeLearned_Client(RecipeTemplate);
 	OnRecipeLearned.Broadcast(RecipeTemplate);
 	return true;
@@ -146,6 +188,8 @@ bool UMounteaCraftingParticipantComponent::ForgetRecipe_Implementation(UMounteaR
 	}
 
 	KnownRecipes.Remove(RecipeTemplate->RecipeGuid);
+	KnownRecipeTemplates.Remove(RecipeTemplate->RecipeGuid);
+	RebuildCraftabilityCache();
 	PostRecipeForgotten_Client(RecipeTemplate);
 	OnRecipeForgotten.Broadcast(RecipeTemplate);
 	return true;
@@ -156,6 +200,52 @@ bool UMounteaCraftingParticipantComponent::IsCraftingPossible_Implementation(UMo
 	return Execute_IsRecipeKnown(this, TemplateToCraft);
 }
 
+FMounteaRecipeCraftability UMounteaCraftingParticipantComponent::GetRecipeCraftability_Implementation(UMounteaRecipeTemplate* RecipeTemplate) const
+{
+	if (!IsValid(RecipeTemplate))
+		return FMounteaRecipeCraftability();
+
+	if (const FMounteaRecipeCraftability* recipeCraftability = RecipeCraftability.Find(RecipeTemplate->RecipeGuid))
+		return *recipeCraftability;
+
+	// Recipe is not known, cached quantities cover only ingredients of known recipes
+	TMap<TObjectPtr<UMounteaInventoryItemTemplate>, int32> recipeQuantities;
+	TSet<UMounteaInventoryItemTemplate*> uncachedIngredients;
+	for (const UMounteaRecipeIngredientsList* ingredientGroup : RecipeTemplate->RecipeIngredientOptions)
+	{
+		if (!IsValid(ingredientGroup))
+			continue;
+
+		for (const UMounteaRecipeIngredient* ingredient : ingredientGroup->RecipeIngredients)
+		{
+			UMounteaInventoryItemTemplate* ingredientTemplate = IsValid(ingredient) ? ingredient->IngredientSource.Get() : nullptr;
+			if (!IsValid(ingredientTemplate) || recipeQuantities.Contains(ingredientTemplate))
+				continue;
+
+			if (const int32* cachedQuantity = IngredientQuantities.Find(ingredientTemplate))
+			{
+				recipeQuantities.Add(ingredientTemplate, *cachedQuantity);
+				continue;
+			}
+
+			recipeQuantities.Add(ingredientTemplate, 0);
+			uncachedIngredients.Add(ingredientTemplate);
+		}
+	}
+
+	if (RelatedInventory.GetObject() && uncachedIngredients.Num() > 0)
+	{
+		const TArray<FMounteaInventoryItem> inventoryItems = IMounteaAdvancedInventoryInterface::Execute_GetAllItems(RelatedInventory.GetObject());
+		for (const FMounteaInventoryItem& inventoryItem : inventoryItems)
+		{
+			if (uncachedIngredients.Contains(inventoryItem.Template))
+				recipeQuantities.FindChecked(inventoryItem.Template) += inventoryItem.GetQuantity();
+		}
+	}
+
+	return UMounteaCraftingStatics::CalculateRecipeCraftability(RecipeTemplate, recipeQuantities);
+}
+
 FMounteaCraftingResult UMounteaCraftingParticipantComponent::StartCrafting_Implementation(UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients)
 {
 	if (!GetOwner()->HasAuthority())
@@ -170,11 +260,42 @@ FMounteaCraftingResult UMounteaCraftingParticipantComponent::StartCrafting_Imple
 	return result;
 }
 
+FMounteaCraftingResult UMounteaCraftingParticipantComponent::StartCraftingMultiple_Implementation(UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients, const int32 CraftCount)
+{
+	if (!GetOwner()->HasAuthority())
+	{
+		Server_StartCraftingMultiple(TemplateToCraft, Ingredients, CraftCount);
+		return FMounteaCraftingResult{};
+	}
+
+	FMounteaCraftingResult result = UMounteaCraftingStatics::CraftItems(this, TemplateToCraft, Ingredients, CraftCount);
+	PostCraftingFinished_Client(result);
+	OnCraftingFinished.Broadcast(result);
+	return result;
+}
+
 bool UMounteaCraftingParticipantComponent::SetParentInventory_Implementation(const TScriptInterface<IMounteaAdvancedInventoryInterface>& NewParentInventory)
 {
 	if (RelatedInventory == NewParentInventory)
 		return false;
+
+	if (IMounteaAdvancedInventoryInterface* oldInventory = RelatedInventory.GetInterface())
+	{
+		oldInventory->GetOnItemAddedEventHandle().RemoveDynamic(this, &UMounteaCraftingParticipantComponent::OnParentInventoryItemAdded);
+		oldInventory->GetOnItemRemovedEventHandle().RemoveDynamic(this, &UMounteaCraftingParticipantComponent::OnParentInventoryItemRemoved);
+		oldInventory->GetOnItemQuantityChangedEventHandle().RemoveDynamic(this, &UMounteaCraftingParticipantComponent::OnParentInventoryItemQuantityChanged);
+	}
+	
 	RelatedInventory = NewParentInventory;
+
+	if (IMounteaAdvancedInventoryInterface* newInventory = RelatedInventory.GetInterface())
+	{
+		newInventory->GetOnItemAddedEventHandle().AddUniqueDynamic(this, &UMounteaCraftingParticipantComponent::OnParentInventoryItemAdded);
+		newInventory->GetOnItemRemovedEventHandle().AddUniqueDynamic(this, &UMounteaCraftingParticipantComponent::OnParentInventoryItemRemoved);
+		newInventory->GetOnItemQuantityChangedEventHandle().AddUniqueDynamic(this, &UMounteaCraftingParticipantComponent::OnParentInventoryItemQuantityChanged);
+	}
+	
+	RebuildCraftabilityCache();
 	return true;
 }
 
@@ -215,32 +336,113 @@ bool UMounteaCraftingParticipantComponent::StopUsingCraftingStation_Implementati
 	return true;
 }
 
-TArray<UMounteaRecipeTemplate*> UMounteaCraftingParticipantComponent::ResolveKnownRecipeTemplates(const TArray<FGuid>& KnownRecipeGuids)
+void UMounteaCraftingParticipantComponent::RebuildKnownRecipeTemplates()
 {
-	if (KnownRecipeGuids.Num() == 0)
-		return TArray<UMounteaRecipeTemplate*>();
+	KnownRecipeTemplates.Reset();
+	KnownRecipeTemplates.Reserve(KnownRecipes.Num());
 
-	const TArray<UMounteaRecipeTemplate*> allRecipes = UMounteaCraftingStatics::GetAllRecipeTemplates().Array();
-	if (allRecipes.Num() == 0)
-		return TArray<UMounteaRecipeTemplate*>();
+	for (const FGuid& knownRecipe : KnownRecipes)
+	{
+		if (UMounteaRecipeTemplate* recipeTemplate = FMounteaAdvancedInventorySettingsCache::FindRecipe(knownRecipe))
+			KnownRecipeTemplates.Add(knownRecipe, recipeTemplate);
+	}
+}
 
-	TArray<UMounteaRecipeTemplate*> result;
-	result.Reserve(KnownRecipeGuids.Num());
+void UMounteaCraftingParticipantComponent::OnAllowedRecipesChanged()
+{
+	RebuildKnownRecipeTemplates();
+	RebuildCraftabilityCache();
+}
+
+void UMounteaCraftingParticipantComponent::RebuildCraftabilityCache()
+{
+	RecipeCraftability.Reset();
+	IngredientQuantities.Reset();
+	RecipesByIngredient.Reset();
 
-	const auto allRecipesArray = allRecipes;
-	for (const FGuid& knownRecipeGuid : KnownRecipeGuids)
+	TArray<FSoftObjectPath> ingredientsToLoad;
+	const TArray<UMounteaRecipeTemplate*> knownRecipes = Execute_GetKnownRecipes(this);
+	for (const UMounteaRecipeTemplate* recipe : knownRecipes)
 	{
-		UMounteaRecipeTemplate* const* foundRecipe = allRecipesArray.FindByPredicate(
-			[&knownRecipeGuid](const UMounteaRecipeTemplate* recipe)
+		for (const UMounteaRecipeIngredientsList* ingredientGroup : recipe->RecipeIngredientOptions)
+		{
+			if (!IsValid(ingredientGroup))
+				continue;
+			
+			for (const UMounteaRecipeIngredient* ingredient : ingredientGroup->RecipeIngredients)
 			{
-				return IsValid(recipe) && recipe->RecipeGuid == knownRecipeGuid;
-			});
+				if (!IsValid(ingredient) || ingredient->IngredientSource.IsNull())
+					continue;
+
+				UMounteaInventoryItemTemplate* ingredientTemplate = ingredient->IngredientSource.Get();
+				if (!IsValid(ingredientTemplate))
+				{
+					const FSoftObjectPath ingredientPath = ingredient->IngredientSource.ToSoftObjectPath();
+					if (!RequestedIngredientPaths.Contains(ingredientPath))
+					{
+						RequestedIngredientPaths.Add(ingredientPath);
+						ingredientsToLoad.Add(ingredientPath);
+					}
+					continue;
+				}
+
+				IngredientQuantities.Add(ingredientTemplate, 0);
+				RecipesByIngredient.FindOrAdd(ingredientTemplate).AddUnique(recipe->RecipeGuid);
+			}
+		}
+	}
 
-		if (foundRecipe != nullptr && IsValid(*foundRecipe))
-			result.Add(*foundRecipe);
+	// Single pass over Inventory instead of searching it per ingredient
+	if (RelatedInventory.GetObject() && IngredientQuantities.Num() > 0)
+	{
+		const TArray<FMounteaInventoryItem> inventoryItems = IMounteaAdvancedInventoryInterface::Execute_GetAllItems(RelatedInventory.GetObject());
+		for (const FMounteaInventoryItem& inventoryItem : inventoryItems)
+		{
+			if (int32* ingredientQuantity = IngredientQuantities.Find(inventoryItem.Template))
+				*ingredientQuantity += inventoryItem.GetQuantity();
+		}
 	}
 
-	return result;
+	RecipeCraftability.Reserve(knownRecipes.Num());
+	for (UMounteaRecipeTemplate* recipe : knownRecipes)
+		RecipeCraftability.Add(recipe->RecipeGuid, UMounteaCraftingStatics::CalculateRecipeCraftability(recipe, IngredientQuantities));
+
+	// Not loaded ingredient cannot be in Inventory, it is counted once it streams in
+	if (ingredientsToLoad.Num() > 0)
+	{
+		TSharedPtr<FStreamableHandle> loadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			ingredientsToLoad,
+			FStreamableDelegate::CreateUObject(this, &UMounteaCraftingParticipantComponent::OnCraftabilityIngredientsLoaded));
+		if (loadHandle.IsValid())
+			IngredientLoadHandles.Add(loadHandle);
+	}
+}
+
+void UMounteaCraftingParticipantComponent::OnCraftabilityIngredientsLoaded()
+{
+	RebuildCraftabilityCache();
+}
+
+void UMounteaCraftingParticipantComponent::ApplyIngredientQuantityDelta(const FMounteaInventoryItem& Item, const int32 QuantityDelta)
+{
+	if (QuantityDelta == 0 || !Item.Template)
+		return;
+
+	int32* ingredientQuantity = IngredientQuantities.Find(Item.Template);
+	if (!ingredientQuantity)
+		return;
+
+	*ingredientQuantity = FMath::Max(0, *ingredientQuantity + QuantityDelta);
+
+	const TArray<FGuid>* affectedRecipes = RecipesByIngredient.Find(Item.Template);
+	if (!affectedRecipes)
+		return;
+
+	for (const FGuid& affectedRecipe : *affectedRecipes)
+	{
+		if (FMounteaRecipeCraftability* recipeCraftability = RecipeCraftability.Find(affectedRecipe))
+			*recipeCraftability = UMounteaCraftingStatics::CalculateRecipeCraftability(recipeCraftability->Recipe, IngredientQuantities);
+	}
 }
 
 void UMounteaCraftingParticipantComponent::Server_LearnRecipe_Implementation(UMounteaRecipeTemplate* RecipeTemplate)
@@ -258,6 +460,11 @@ void UMounteaCraftingParticipantComponent::Server_StartCrafting_Implementation(U
 	Execute_StartCrafting(this, TemplateToCraft, Ingredients);
 }
 
+void UMounteaCraftingParticipantComponent::Server_StartCraftingMultiple_Implementation(UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients, const int32 CraftCount)
+{
+	Execute_StartCraftingMultiple(this, TemplateToCraft, Ingredients, CraftCount);
+}
+
 void UMounteaCraftingParticipantComponent::Server_StartUsingCraftingStation_Implementation(const TScriptInterface<IMounteaAdvancedCraftingStationInterface>& Station)
 {
 	Execute_StartUsingCraftingStation(this, Station);
@@ -13,7 +13,10 @@
 #include "Components/MounteaCraftingStationComponent.h"
 
 #include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 #include "Definitions/MounteaCraftingBaseEnums.h"
+#include "Definitions/MounteaRecipeTemplate.h"
+#include "GameFramework/GameStateBase.h"
 
 UMounteaCraftingStationComponent::UMounteaCraftingStationComponent()
 {
@@ -35,17 +38,31 @@ void UMounteaCraftingStationComponent::BeginPlay()
 	Super::BeginPlay();
 }
 
+void UMounteaCraftingStationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (const UWorld* world = GetWorld())
+		world->GetTimerManager().ClearTimer(CraftingJobTimerHandle);
+	
+	Super::EndPlay(EndPlayReason);
+}
+
 void UMounteaCraftingStationComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	DOREPLIFETIME(UMounteaCraftingStationComponent, CraftingStationState);
 	DOREPLIFETIME(UMounteaCraftingStationComponent, CraftingParticipants);
+	DOREPLIFETIME(UMounteaCraftingStationComponent, CraftingJobs);
 }
 
 void UMounteaCraftingStationComponent::OnRep_CraftingStationState()
 {
 }
 
+void UMounteaCraftingStationComponent::OnRep_CraftingJobs()
+{
+	OnCraftingJobsChanged.Broadcast();
+}
+
 bool UMounteaCraftingStationComponent::IsCraftingPlaceOccupied_Implementation() const
 {
 	return CraftingStationState == ECraftingStationState::EASS_Occupied;
@@ -126,9 +143,174 @@ bool UMounteaCraftingStationComponent::StopUsing_Implementation(const TScriptInt
 	CraftingParticipants.Remove(Participant);
 	Execute_SetCraftingStationState(this, ECraftingStationState::EASS_Empty);
 
+	// Jobs craft into participant's inventory, so they cannot outlive participant's presence
+	const int32 removedJobs = CraftingJobs.RemoveAll([&Participant](const FMounteaCraftingJob& craftingJob)
+	{
+		return craftingJob.Participant == Participant;
+	});
+	if (removedJobs > 0)
+		AdvanceCraftingJobs();
+
 	return true;
 }
 
+FGuid UMounteaCraftingStationComponent::EnqueueCraftingJob_Implementation(const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant, UMounteaRecipeTemplate* Recipe, UMounteaRecipeIngredientsList* Ingredients, const int32 Quantity)
+{
+	if (!IsValid(Participant.GetObject()) || !IsValid(Recipe) || !IsValid(Ingredients) || Quantity <= 0)
+		return FGuid();
+
+	const FGuid jobGuid = FGuid::NewGuid();
+	
+	// Client Guid is provisional, server validates it and reports rejection back
+	if (!GetOwner()->HasAuthority())
+	{
+		Server_EnqueueCraftingJob(jobGuid, Participant, Recipe, Ingredients, Quantity);
+		return jobGuid;
+	}
+
+	return EnqueueCraftingJobInternal(jobGuid, Participant, Recipe, Ingredients, Quantity) ? jobGuid : FGuid();
+}
+
+bool UMounteaCraftingStationComponent::CancelCraftingJob_Implementation(const FGuid& JobGuid)
+{
+	if (!GetOwner()->HasAuthority())
+	{
+		Server_CancelCraftingJob(JobGuid);
+		return true;
+	}
+
+	const int32 jobIndex = CraftingJobs.IndexOfByPredicate([&JobGuid](const FMounteaCraftingJob& craftingJob)
+	{
+		return craftingJob.JobGuid == JobGuid;
+	});
+	if (jobIndex == INDEX_NONE)
+		return false;
+
+	CraftingJobs.RemoveAt(jobIndex);
+	AdvanceCraftingJobs();
+	return true;
+}
+
+float UMounteaCraftingStationComponent::GetCraftingJobProgress_Implementation(const FGuid& JobGuid) const
+{
+	const FMounteaCraftingJob* craftingJob = CraftingJobs.FindByPredicate([&JobGuid](const FMounteaCraftingJob& job)
+	{
+		return job.JobGuid == JobGuid;
+	});
+	if (!craftingJob || !craftingJob->IsRunning())
+		return 0.f;
+
+	if (craftingJob->Duration <= 0.f)
+		return 1.f;
+
+	return FMath::Clamp(static_cast<float>((GetCraftingTime() - craftingJob->StartTime) / craftingJob->Duration), 0.f, 1.f);
+}
+
+double UMounteaCraftingStationComponent::GetCraftingTime() const
+{
+	const UWorld* world = GetWorld();
+	if (!world)
+		return 0.0;
+
+	const AGameStateBase* gameState = world->GetGameState();
+	return gameState ? gameState->GetServerWorldTimeSeconds() : world->GetTimeSeconds();
+}
+
+bool UMounteaCraftingStationComponent::EnqueueCraftingJobInternal(const FGuid& JobGuid, const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant, UMounteaRecipeTemplate* Recipe, UMounteaRecipeIngredientsList* Ingredients, const int32 Quantity)
+{
+	if (!JobGuid.IsValid() || !IsValid(Participant.GetObject()) || !IsValid(Recipe) || !IsValid(Ingredients) || Quantity <= 0)
+		return false;
+
+	if (!CraftingParticipants.Contains(Participant))
+		return false;
+
+	if (Recipe->RequiredCraftingPlace.IsValid() && Recipe->RequiredCraftingPlace != CraftingStationType)
+		return false;
+
+	if (!Recipe->RecipeIngredientOptions.Contains(Ingredients))
+		return false;
+
+	if (!IMounteaAdvancedCraftingParticipantInterface::Execute_IsCraftingPossible(Participant.GetObject(), Recipe))
+		return false;
+
+	if (CraftingJobs.ContainsByPredicate([&JobGuid](const FMounteaCraftingJob& craftingJob) { return craftingJob.JobGuid == JobGuid; }))
+		return false;
+
+	FMounteaCraftingJob& newJob = CraftingJobs.AddDefaulted_GetRef();
+	newJob.JobGuid = JobGuid;
+	newJob.Recipe = Recipe;
+	newJob.Ingredients = Ingredients;
+	newJob.Participant = Participant;
+	newJob.Duration = FMath::Max(0.f, Recipe->CraftingTime);
+	newJob.Quantity = Quantity;
+
+	AdvanceCraftingJobs();
+	return true;
+}
+
+void UMounteaCraftingStationComponent::AdvanceCraftingJobs()
+{
+	if (!GetOwner()->HasAuthority())
+		return;
+	
+	const double currentTime = GetCraftingTime();
+	
+	while (CraftingJobs.Num() > 0)
+	{
+		FMounteaCraftingJob& runningJob = CraftingJobs[0];
+		if (!runningJob.IsRunning())
+			runningJob.StartTime = currentTime;
+
+		if (runningJob.GetUnitFinishTime() > currentTime)
+			break;
+
+		const FGuid runningJobGuid = runningJob.JobGuid;
+		const double unitFinishTime = runningJob.GetUnitFinishTime();
+		const FMounteaCraftingResult craftingResult = IsValid(runningJob.Participant.GetObject())
+			? IMounteaAdvancedCraftingParticipantInterface::Execute_StartCrafting(runningJob.Participant.GetObject(), runningJob.Recipe, runningJob.Ingredients)
+			: FMounteaCraftingResult();
+
+		// Crafting callbacks might have modified the queue
+		if (CraftingJobs.Num() == 0 || CraftingJobs[0].JobGuid != runningJobGuid)
+			continue;
+
+		FMounteaCraftingJob& finishedJob = CraftingJobs[0];
+		finishedJob.CompletedQuantity++;
+		
+		if (!craftingResult.bCraftingSuccess || finishedJob.CompletedQuantity >= finishedJob.Quantity)
+		{
+			CraftingJobs.RemoveAt(0);
+			// Next job continues from the moment previous one finished, so late timers do not add drift
+			if (craftingResult.bCraftingSuccess && CraftingJobs.Num() > 0)
+				CraftingJobs[0].StartTime = unitFinishTime;
+			continue;
+		}
+
+		finishedJob.StartTime = unitFinishTime;
+	}
+
+	ScheduleNextCraftingJob();
+	OnCraftingJobsChanged.Broadcast();
+}
+
+void UMounteaCraftingStationComponent::ScheduleNextCraftingJob()
+{
+	UWorld* world = GetWorld();
+	if (!world)
+		return;
+
+	FTimerManager& timerManager = world->GetTimerManager();
+	if (CraftingJobs.Num() == 0)
+	{
+		timerManager.ClearTimer(CraftingJobTimerHandle);
+		return;
+	}
+
+	// Single timer per station fires only when a unit is due, no per-frame polling
+	const float timeToNextUnit = static_cast<float>(CraftingJobs[0].GetUnitFinishTime() - GetCraftingTime());
+	timerManager.SetTimer(CraftingJobTimerHandle, this, &UMounteaCraftingStationComponent::AdvanceCraftingJobs, FMath::Max(timeToNextUnit, KINDA_SMALL_NUMBER), false);
+}
+
 void UMounteaCraftingStationComponent::Server_StartUsing_Implementation(const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant)
 {
 	Execute_StartUsing(this, Participant);
@@ -143,3 +325,20 @@ void UMounteaCraftingStationComponent::Server_SetCraftingStationState_Implementa
 {
 	Execute_SetCraftingStationState(this, NewState);
 }
+
+void UMounteaCraftingStationComponent::Server_EnqueueCraftingJob_Implementation(const FGuid& JobGuid, const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant, UMounteaRecipeTemplate* Recipe, UMounteaRecipeIngredientsList* Ingredients, const int32 Quantity)
+{
+	// Invalid or already used Guid is refused the same way as invalid job
+	if (!EnqueueCraftingJobInternal(JobGuid, Participant, Recipe, Ingredients, Quantity))
+		Client_CraftingJobRejected(JobGuid);
+}
+
+void UMounteaCraftingStationComponent::Client_CraftingJobRejected_Implementation(const FGuid& JobGuid)
+{
+	OnCraftingJobRejected.Broadcast(JobGuid);
+}
+
+void UMounteaCraftingStationComponent::Server_CancelCraftingJob_Implementation(const FGuid& JobGuid)
+{
+	Execute_CancelCraftingJob(this, JobGuid);
+}
@@ -18,8 +18,10 @@
 #include "Definitions/MounteaAdvancedAttachmentSlot.h"
 #include "Definitions/MounteaEquipmentBaseEnums.h"
 #include "Definitions/MounteaInventoryItemTemplate.h"
+#include "Engine/AssetManager.h"
 #include "GameFramework/Actor.h"
 #include "Interfaces/Equipment/MounteaAdvancedEquipmentItemInterface.h"
+#include "Interfaces/Inventory/MounteaAdvancedInventoryInterface.h"
 #include "Logs/MounteaAdvancedInventoryLog.h"
 #include "Statics/MounteaEquipmentStatics.h"
 
@@ -28,6 +30,34 @@ UMounteaEquipmentComponent::UMounteaEquipmentComponent()
 	ComponentTags.Append( { TEXT("Equipment") } );
 }
 
+void UMounteaEquipmentComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	OnAttachmentChanged.AddUniqueDynamic(this, &UMounteaEquipmentComponent::OnEquipmentAttachmentChanged);
+	MarkEquippedItemSlotsDirty();
+}
+
+void UMounteaEquipmentComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	OnAttachmentChanged.RemoveDynamic(this, &UMounteaEquipmentComponent::OnEquipmentAttachmentChanged);
+
+	for (UObject* inventory : GetOwningInventories())
+	{
+		if (IMounteaAdvancedInventoryInterface* inventoryInterface = Cast<IMounteaAdvancedInventoryInterface>(inventory))
+			inventoryInterface->GetOnItemRemovedEventHandle().RemoveDynamic(this, &UMounteaEquipmentComponent::OnOwningInventoryItemRemoved);
+	}
+
+	for (const TPair<FGuid, FPendingEquipmentLoad>& pendingLoad : PendingEquipmentLoads)
+	{
+		if (pendingLoad.Value.LoadHandle.IsValid())
+			pendingLoad.Value.LoadHandle->CancelHandle();
+	}
+	PendingEquipmentLoads.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UMounteaEquipmentComponent::Server_EquipItem_Implementation(const FMounteaInventoryItem& ItemDefinition)
 {
 	Execute_EquipItem(this, ItemDefinition);
@@ -65,12 +95,10 @@ bool UMounteaEquipmentComponent::ValidateEquipRequest(const FMounteaInventoryIte
 		return false;
 	}
 
-	UClass* spawnClass = spawnActorClass.LoadSynchronous();
+	// Class which is not loaded yet gets validated once it streams in
+	UClass* spawnClass = spawnActorClass.Get();
 	if (!IsValid(spawnClass))
-	{
-		LOG_WARNING(TEXT("[Equip Item]: Spawn Actor class failed to load. No equipment will happen."))
-		return false;
-	}
+		return true;
 
 	if (!UMounteaEquipmentStatics::IsTargetClassValid(spawnClass))
 	{
@@ -133,6 +161,109 @@ bool UMounteaEquipmentComponent::TryExecuteEquipOverride(const FMounteaInventory
 	return params.ReturnValue;
 }
 
+bool UMounteaEquipmentComponent::RequestEquipmentLoad(const FMounteaInventoryItem& ItemDefinition, const FName& TargetSlotId)
+{
+	const UMounteaInventoryItemTemplate* templateAsset = ItemDefinition.GetTemplate();
+	if (!IsValid(templateAsset) || templateAsset->SpawnActor.IsNull() || templateAsset->SpawnActor.Get())
+		return false;
+
+	const FGuid itemGuid = ItemDefinition.GetGuid();
+	if (PendingEquipmentLoads.Contains(itemGuid))
+		return true;
+
+	FPendingEquipmentLoad pendingLoad;
+	pendingLoad.ItemDefinition = ItemDefinition;
+	pendingLoad.TargetSlotId = TargetSlotId;
+	PendingEquipmentLoads.Add(itemGuid, pendingLoad);
+
+	const TSharedPtr<FStreamableHandle> loadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		templateAsset->SpawnActor.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &UMounteaEquipmentComponent::OnEquipmentLoaded, itemGuid));
+
+	// Class might have finished loading right away, caller equips it directly then
+	if (!loadHandle.IsValid() || loadHandle->HasLoadCompleted())
+	{
+		PendingEquipmentLoads.Remove(itemGuid);
+		return false;
+	}
+
+	if (FPendingEquipmentLoad* storedLoad = PendingEquipmentLoads.Find(itemGuid))
+		storedLoad->LoadHandle = loadHandle;
+
+	// Item dropped from inventory while loading must not get equipped
+	for (UObject* inventory : GetOwningInventories())
+	{
+		if (IMounteaAdvancedInventoryInterface* inventoryInterface = Cast<IMounteaAdvancedInventoryInterface>(inventory))
+			inventoryInterface->GetOnItemRemovedEventHandle().AddUniqueDynamic(this, &UMounteaEquipmentComponent::OnOwningInventoryItemRemoved);
+	}
+	return true;
+}
+
+bool UMounteaEquipmentComponent::CancelEquipmentLoad(const FGuid& ItemGuid)
+{
+	FPendingEquipmentLoad pendingLoad;
+	if (!PendingEquipmentLoads.RemoveAndCopyValue(ItemGuid, pendingLoad))
+		return false;
+
+	if (pendingLoad.LoadHandle.IsValid())
+		pendingLoad.LoadHandle->CancelHandle();
+	return true;
+}
+
+void UMounteaEquipmentComponent::OnEquipmentLoaded(FGuid ItemGuid)
+{
+	// Load handle is not stored yet if delegate fires from within RequestEquipmentLoad, which handles that case
+	const FPendingEquipmentLoad* storedLoad = PendingEquipmentLoads.Find(ItemGuid);
+	if (!storedLoad || !storedLoad->LoadHandle.IsValid())
+		return;
+
+	FPendingEquipmentLoad pendingLoad;
+	PendingEquipmentLoads.RemoveAndCopyValue(ItemGuid, pendingLoad);
+
+	const UMounteaInventoryItemTemplate* templateAsset = pendingLoad.ItemDefinition.GetTemplate();
+	if (!IsValid(templateAsset) || !IsValid(templateAsset->SpawnActor.Get()))
+	{
+		LOG_WARNING(TEXT("[Equip Item]: Spawn Actor class failed to load. No equipment will happen."))
+		return;
+	}
+
+	// Item might have changed or left the inventory while loading, equip its current state only
+	FMounteaInventoryItem currentItem;
+	if (!UMounteaEquipmentStatics::TryResolveInventoryItemByGuid(this, ItemGuid, currentItem))
+	{
+		LOG_WARNING(TEXT("[Equip Item]: Item is no longer in owning inventory. No equipment will happen."))
+		return;
+	}
+
+	EquipLoadedItem(currentItem, pendingLoad.TargetSlotId);
+}
+
+AActor* UMounteaEquipmentComponent::EquipLoadedItem(const FMounteaInventoryItem& ItemDefinition, const FName& TargetSlotId)
+{
+	// SpawnActor class is validated only once it is loaded
+	if (!ValidateEquipRequest(ItemDefinition))
+		return nullptr;
+
+	AActor* spawnedActor = nullptr;
+	if (TargetSlotId.IsNone())
+	{
+		const bool bResult = UMounteaEquipmentStatics::EquipItemGeneral(this, ItemDefinition, spawnedActor);
+		return bResult ? spawnedActor : nullptr;
+	}
+
+	UMounteaAdvancedAttachmentSlot* targetSlot = Execute_GetSlot(this, TargetSlotId);
+	if (!IsValid(targetSlot))
+		return nullptr;
+
+	const bool bResult = UMounteaEquipmentStatics::EquipItemToSlot(this, ItemDefinition, targetSlot, spawnedActor);
+	return bResult ? spawnedActor : nullptr;
+}
+
+bool UMounteaEquipmentComponent::IsEquipmentLoadPending(const FGuid& ItemGuid) const
+{
+	return PendingEquipmentLoads.Contains(ItemGuid);
+}
+
 AActor* UMounteaEquipmentComponent::EquipItem_Implementation(const FMounteaInventoryItem& ItemDefinition)
 {
 	if (!ValidateEquipRequest(ItemDefinition))
@@ -148,9 +279,11 @@ AActor* UMounteaEquipmentComponent::EquipItem_Implementation(const FMounteaInven
 	if (TryExecuteEquipOverride(ItemDefinition, spawnedActor))
 		return spawnedActor;
 
-	// Fallback
-	const bool bResult = UMounteaEquipmentStatics::EquipItemGeneral(this, ItemDefinition, spawnedActor);
-	return bResult ? spawnedActor : nullptr;
+	// Fallback, deferred until the Spawn Actor class is loaded
+	if (RequestEquipmentLoad(ItemDefinition, NAME_None))
+		return nullptr;
+
+	return EquipLoadedItem(ItemDefinition, NAME_None);
 }
 
 AActor* UMounteaEquipmentComponent::EquipItemToSlot_Implementation(const FName& SlotId, const FMounteaInventoryItem& ItemDefinition)
@@ -167,13 +300,10 @@ AActor* UMounteaEquipmentComponent::EquipItemToSlot_Implementation(const FName&
 		return nullptr;
 	}
 
-	UMounteaAdvancedAttachmentSlot* targetSlot = Execute_GetSlot(this, SlotId);
-	if (!IsValid(targetSlot))
+	if (RequestEquipmentLoad(ItemDefinition, SlotId))
 		return nullptr;
 
-	AActor* spawnedActor = nullptr;
-	const bool bResult = UMounteaEquipmentStatics::EquipItemToSlot(this, ItemDefinition, targetSlot, spawnedActor);
-	return bResult ? spawnedActor : nullptr;
+	return EquipLoadedItem(ItemDefinition, SlotId);
 }
 
 bool UMounteaEquipmentComponent::UnequipItem_Implementation(const FMounteaInventoryItem& ItemDefinition, const bool bUseFallbackSlot)
@@ -187,6 +317,10 @@ bool UMounteaEquipmentComponent::UnequipItem_Implementation(const FMounteaInvent
 		return true;
 	}
 
+	// Item still waiting for its SpawnActor class is not equipped yet, cancelling the request unequips it
+	if (CancelEquipmentLoad(ItemDefinition.GetGuid()))
+		return true;
+
 	const TArray<UMounteaAdvancedAttachmentSlot*> attachmentSlots = Execute_GetAttachmentSlots(this);
 	for (const UMounteaAdvancedAttachmentSlot* slot : attachmentSlots)
 	{
@@ -250,7 +384,7 @@ bool UMounteaEquipmentComponent::UnequipItemFromSlot_Implementation(const FName&
 
 	AActor* detachedAttachmentActor = UMounteaEquipmentStatics::ResolveAttachmentActor(attachmentObject);
 	if (IsValid(detachedAttachmentActor) && detachedAttachmentActor != GetOwner())
-		detachedAttachmentActor->Destroy();
+		UMounteaEquipmentStatics::ReleaseEquipmentActor(detachedAttachmentActor);
 
 	return true;
 }
@@ -516,8 +650,15 @@ void UMounteaEquipmentComponent::ResetPendingActivationIfExpired()
 	}
 }
 
-bool UMounteaEquipmentComponent::IsTransitionInProgress(const EEquipmentTransitionType RequestedTransitionType) const
+bool UMounteaEquipmentComponent::IsTransitionInProgress(const EEquipmentTransitionType RequestedTransitionType, const FGuid& ItemGuid) const
 {
+	// Pending load only blocks the item it belongs to
+	if (ItemGuid.IsValid() && PendingEquipmentLoads.Contains(ItemGuid) &&
+		(RequestedTransitionType == EEquipmentTransitionType::EET_None || RequestedTransitionType == EEquipmentTransitionType::EET_Equip))
+	{
+		return true;
+	}
+
 	if (PendingActivation.IsValid())
 	{
 		if (RequestedTransitionType == EEquipmentTransitionType::EET_None)
@@ -615,7 +756,7 @@ bool UMounteaEquipmentComponent::ExecuteItemTransitionRequest(const FMounteaInve
 	if (!ItemDefinition.IsItemValid())
 		return false;
 
-	if (IsTransitionInProgress())
+	if (IsTransitionInProgress(EEquipmentTransitionType::EET_None, ItemDefinition.GetGuid()))
 		return false;
 
 	FEquipmentTransitionContext transitionContext;
@@ -756,7 +897,7 @@ bool UMounteaEquipmentComponent::RegisterQuickUsePlaceholderActor(const FGuid& I
 	{
 		LOG_WARNING(TEXT("[Register Quick Use Placeholder Actor]: Replacing existing quick use placeholder actor."))
 		if (AActor* existingPlaceholder = QuickUsePlaceholderActor.Get(); IsValid(existingPlaceholder))
-			existingPlaceholder->Destroy();
+			UMounteaEquipmentStatics::ReleaseEquipmentActor(existingPlaceholder);
 	}
 
 	QuickUsePlaceholderActor = PlaceholderActor;
@@ -777,11 +918,167 @@ bool UMounteaEquipmentComponent::ConsumeQuickUsePlaceholderActor(const FGuid& It
 	QuickUsePlaceholderItemGuid.Invalidate();
 
 	if (placeholderActor != GetOwner())
-		placeholderActor->Destroy();
+		UMounteaEquipmentStatics::ReleaseEquipmentActor(placeholderActor);
 
 	return true;
 }
 
+bool UMounteaEquipmentComponent::TryAttach_Implementation(const FName& SlotId, UObject* Attachment)
+{
+	const bool bResult = Super::TryAttach_Implementation(SlotId, Attachment);
+	MarkEquippedItemSlotsDirty();
+	return bResult;
+}
+
+bool UMounteaEquipmentComponent::TryDetach_Implementation(const FName& SlotId)
+{
+	const bool bResult = Super::TryDetach_Implementation(SlotId);
+	MarkEquippedItemSlotsDirty();
+	return bResult;
+}
+
+bool UMounteaEquipmentComponent::ForceAttach_Implementation(const FName& SlotId, UObject* Attachment)
+{
+	const bool bResult = Super::ForceAttach_Implementation(SlotId, Attachment);
+	MarkEquippedItemSlotsDirty();
+	return bResult;
+}
+
+bool UMounteaEquipmentComponent::ForceDetach_Implementation(const FName& SlotId)
+{
+	const bool bResult = Super::ForceDetach_Implementation(SlotId);
+	MarkEquippedItemSlotsDirty();
+	return bResult;
+}
+
+void UMounteaEquipmentComponent::ClearAll_Implementation()
+{
+	Super::ClearAll_Implementation();
+	MarkEquippedItemSlotsDirty();
+}
+
+UMounteaAdvancedAttachmentSlot* UMounteaEquipmentComponent::FindSlotByEquippedItemGuid(const FGuid& ItemGuid,
+	TScriptInterface<IMounteaAdvancedEquipmentItemInterface>& OutInterface) const
+{
+	OutInterface = TScriptInterface<IMounteaAdvancedEquipmentItemInterface>();
+	if (!ItemGuid.IsValid())
+		return nullptr;
+
+	const auto resolveIndexedSlot = [this, &ItemGuid, &OutInterface](bool& bOutIsStale) -> UMounteaAdvancedAttachmentSlot*
+	{
+		bOutIsStale = false;
+		const TWeakObjectPtr<UMounteaAdvancedAttachmentSlot>* indexedSlot = EquippedItemSlots.Find(ItemGuid);
+		if (!indexedSlot)
+			return nullptr;
+
+		UMounteaAdvancedAttachmentSlot* slot = indexedSlot->Get();
+		bOutIsStale = true;
+		if (!IsValid(slot) || !slot->IsOccupied() || !IsValid(slot->Attachment))
+			return nullptr;
+
+		const TScriptInterface<IMounteaAdvancedEquipmentItemInterface> equipmentItemInterface =
+			UMounteaEquipmentStatics::FindEquipmentItemInterface(slot->Attachment);
+		if (!equipmentItemInterface.GetObject() ||
+			IMounteaAdvancedEquipmentItemInterface::Execute_GetEquippedItemId(equipmentItemInterface.GetObject()) != ItemGuid)
+		{
+			return nullptr;
+		}
+
+		bOutIsStale = false;
+		OutInterface = equipmentItemInterface;
+		return slot;
+	};
+
+	if (bEquippedItemSlotsDirty)
+		RebuildEquippedItemSlots();
+
+	bool bIsStale = false;
+	if (UMounteaAdvancedAttachmentSlot* foundSlot = resolveIndexedSlot(bIsStale))
+		return foundSlot;
+
+	// Slot contents changed without notification (for example direct slot access), rebuild once
+	if (!bIsStale)
+		return nullptr;
+
+	RebuildEquippedItemSlots();
+	return resolveIndexedSlot(bIsStale);
+}
+
+TArray<UObject*> UMounteaEquipmentComponent::GetOwningInventories() const
+{
+	const bool bHasDestroyedInventory = CachedInventories.ContainsByPredicate([](const TWeakObjectPtr<UObject>& cachedInventory)
+	{
+		return !cachedInventory.IsValid();
+	});
+
+	// Components added to (or removed from) the owner might be inventories
+	const AActor* owningActor = GetOwner();
+	const int32 ownerComponentCount = IsValid(owningActor) ? owningActor->GetComponents().Num() : 0;
+
+	if (!bInventoriesCached || bHasDestroyedInventory || ownerComponentCount != CachedOwnerComponentCount)
+	{
+		const TArray<UObject*> inventories = UMounteaEquipmentStatics::ResolveInventoryObjects(
+			const_cast<UMounteaEquipmentComponent*>(this));
+		CachedInventories.Reset(inventories.Num());
+		for (UObject* inventory : inventories)
+			CachedInventories.Add(inventory);
+		CachedOwnerComponentCount = ownerComponentCount;
+
+		// Inventory might not be created yet, keep resolving until one is found
+		bInventoriesCached = inventories.Num() > 0;
+		return inventories;
+	}
+
+	TArray<UObject*> returnValue;
+	returnValue.Reserve(CachedInventories.Num());
+	for (const TWeakObjectPtr<UObject>& cachedInventory : CachedInventories)
+		returnValue.Add(cachedInventory.Get());
+	return returnValue;
+}
+
+void UMounteaEquipmentComponent::RebuildEquippedItemSlots() const
+{
+	EquippedItemSlots.Reset();
+	bEquippedItemSlotsDirty = false;
+
+	for (UMounteaAdvancedAttachmentSlot* slot : AttachmentSlots)
+	{
+		if (!IsValid(slot) || !slot->IsOccupied() || !IsValid(slot->Attachment))
+			continue;
+
+		const TScriptInterface<IMounteaAdvancedEquipmentItemInterface> equipmentItemInterface =
+			UMounteaEquipmentStatics::FindEquipmentItemInterface(slot->Attachment);
+		if (!equipmentItemInterface.GetObject())
+			continue;
+
+		const FGuid equippedItemId = IMounteaAdvancedEquipmentItemInterface::Execute_GetEquippedItemId(equipmentItemInterface.GetObject());
+
+		// Item id may replicate after the attachment, keep rebuilding until it arrives
+		if (!equippedItemId.IsValid())
+		{
+			bEquippedItemSlotsDirty = true;
+			continue;
+		}
+
+		EquippedItemSlots.Add(equippedItemId, slot);
+	}
+}
+
+void UMounteaEquipmentComponent::MarkEquippedItemSlotsDirty()
+{
+	bEquippedItemSlotsDirty = true;
+}
+
+void UMounteaEquipmentComponent::OnOwningInventoryItemRemoved(const FMounteaInventoryItem& RemovedItem)
+{
+	CancelEquipmentLoad(RemovedItem.GetGuid());
+}
+
+void UMounteaEquipmentComponent::OnEquipmentAttachmentChanged(const FName& SlotId, UObject* NewAttachment, UObject* OldAttachment)
+{
+	MarkEquippedItemSlotsDirty();
+}
+
 bool UMounteaEquipmentComponent::TryGetPendingEquipmentActivation(FPendingEquipmentActivation& OutPendingActivation) const
 {
 	if (IsPendingActivationExpired())
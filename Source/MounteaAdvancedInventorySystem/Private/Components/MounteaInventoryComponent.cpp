@@ -15,11 +15,294 @@
 #include "Definitions/MounteaAdvancedInventoryNotification.h"
 #include "Definitions/MounteaInventoryBaseEnums.h"
 #include "Definitions/MounteaInventoryItemTemplate.h"
+#include "Helpers/MounteaInventoryTemplateRegistry.h"
 #include "Logs/MounteaAdvancedInventoryLog.h"
 #include "Net/UnrealNetwork.h"
 #include "Statics/MounteaInventoryStatics.h"
 #include "Statics/MounteaInventorySystemStatics.h"
 
+namespace MounteaInventoryTransaction
+{
+	/** Change produced by a staged operation, broadcast once the transaction is committed. */
+	struct FStagedChange
+	{
+		EInventoryTransactionOperationType Type = EInventoryTransactionOperationType::Default;
+		FMounteaInventoryItem Item;
+		int32 OldQuantity = 0;
+		int32 NewQuantity = 0;
+		/** Inventory the added quantity is moved from, null for new items. */
+		TScriptInterface<IMounteaAdvancedInventoryInterface> SourceInventory;
+		/** Guid of the moved item in SourceInventory, Item carries destination Guid when stacked. */
+		FGuid SourceItemGuid;
+	};
+
+	/**
+	 * Staged removals only zero the quantity, emptied items are compacted once the staging is done.
+	 * Lookups therefore stay valid for the whole staging and are rebuilt only once, at commit.
+	 */
+	static int32 FindStagedIndexByGuid(const FInventoryItemArray& StagedItems, const FGuid& ItemGuid)
+	{
+		const int32 itemIndex = StagedItems.FindIndexByGuid(ItemGuid);
+		return itemIndex != INDEX_NONE && StagedItems.Items[itemIndex].GetQuantity() > 0 ? itemIndex : INDEX_NONE;
+	}
+
+	static int32 FindStagedIndexByTemplate(const FInventoryItemArray& StagedItems, const UMounteaInventoryItemTemplate* Template)
+	{
+		for (const int32 itemIndex : StagedItems.FindIndicesByTemplate(Template))
+		{
+			if (StagedItems.Items[itemIndex].GetQuantity() > 0)
+				return itemIndex;
+		}
+		return INDEX_NONE;
+	}
+
+	static void CompactStagedItems(FInventoryItemArray& StagedItems)
+	{
+		StagedItems.Items.RemoveAll([](const FMounteaInventoryItem& Item) { return Item.GetQuantity() <= 0; });
+	}
+
+	static bool RemoveQuantityAt(FInventoryItemArray& StagedItems, const int32 Index, const int32 Amount, TArray<FStagedChange>& OutChanges)
+	{
+		auto& stagedItem = StagedItems.Items[Index];
+		const int32 oldQuantity = stagedItem.GetQuantity();
+		if (Amount > oldQuantity)
+			return false;
+
+		if (oldQuantity - Amount <= 0)
+		{
+			OutChanges.Add({ EInventoryTransactionOperationType::EITOT_Remove, stagedItem, oldQuantity, 0 });
+			stagedItem.SetQuantity(0);
+			return true;
+		}
+
+		if (!stagedItem.SetQuantity(oldQuantity - Amount))
+			return false;
+
+		OutChanges.Add({ EInventoryTransactionOperationType::EITOT_ChangeQuantity, stagedItem, oldQuantity, stagedItem.GetQuantity() });
+		return true;
+	}
+
+	static bool StageAdd(FInventoryItemArray& StagedItems, const FMounteaInventoryItem& Item, const TScriptInterface<IMounteaAdvancedInventoryInterface>& OwningInventory, TArray<FStagedChange>& OutChanges)
+	{
+		if (!Item.IsItemValid() || Item.GetQuantity() <= 0)
+			return false;
+
+		// Item owned by another inventory is moved, so source must really hold the quantity
+		TScriptInterface<IMounteaAdvancedInventoryInterface> sourceInventory;
+		if (Item.IsItemInInventory())
+		{
+			sourceInventory = Item.GetOwningInventory();
+			if (!IsValid(sourceInventory.GetObject()) || sourceInventory.GetObject() == OwningInventory.GetObject())
+				return false;
+
+			const FMounteaInventoryItem sourceItem = IMounteaAdvancedInventoryInterface::Execute_FindItem(sourceInventory.GetObject(), FInventoryItemSearchParams(Item.GetGuid()));
+			if (!sourceItem.IsItemValid() || sourceItem.GetQuantity() < Item.GetQuantity())
+				return false;
+		}
+
+		int32 existingIndex = FindStagedIndexByGuid(StagedItems, Item.GetGuid());
+		if (existingIndex == INDEX_NONE)
+			existingIndex = FindStagedIndexByTemplate(StagedItems, Item.GetTemplate());
+
+		if (existingIndex != INDEX_NONE)
+		{
+			auto& existingItem = StagedItems.Items[existingIndex];
+			if (UMounteaInventorySystemStatics::HasFlag(existingItem.GetTemplate()->ItemFlags, EInventoryItemFlags::EIIF_Unique)
+				|| UMounteaInventorySystemStatics::HasFlag(Item.GetTemplate()->ItemFlags, EInventoryItemFlags::EIIF_Unique))
+				return false;
+
+			const int32 oldQuantity = existingItem.GetQuantity();
+			const int32 amountToAdd = FMath::Min(Item.GetQuantity(), existingItem.GetTemplate()->MaxQuantity - oldQuantity);
+			if (amountToAdd <= 0 || !existingItem.SetQuantity(oldQuantity + amountToAdd))
+				return false;
+
+			OutChanges.Add({ EInventoryTransactionOperationType::EITOT_ChangeQuantity, existingItem, oldQuantity, existingItem.GetQuantity(), sourceInventory, Item.GetGuid() });
+			return true;
+		}
+
+		FMounteaInventoryItem newItem = Item;
+		newItem.SetQuantity(FMath::Min(Item.GetQuantity(), Item.GetTemplate()->MaxQuantity));
+		newItem.SetOwningInventory(OwningInventory);
+		StagedItems.AddIndexedItem(newItem);
+
+		OutChanges.Add({ EInventoryTransactionOperationType::EITOT_Add, newItem, 0, newItem.GetQuantity(), sourceInventory, Item.GetGuid() });
+		return true;
+	}
+
+	static bool StageRemove(FInventoryItemArray& StagedItems, const FInventoryTransactionOperation& Operation, TArray<FStagedChange>& OutChanges)
+	{
+		if (Operation.ItemGuid.IsValid())
+		{
+			const int32 itemIndex = FindStagedIndexByGuid(StagedItems, Operation.ItemGuid);
+			if (itemIndex == INDEX_NONE)
+				return false;
+
+			const int32 amountToRemove = Operation.Amount > 0 ? Operation.Amount : StagedItems.Items[itemIndex].GetQuantity();
+			return RemoveQuantityAt(StagedItems, itemIndex, amountToRemove, OutChanges);
+		}
+
+		if (!IsValid(Operation.Template) || FindStagedIndexByTemplate(StagedItems, Operation.Template) == INDEX_NONE)
+			return false;
+
+		// Amount of 0 removes every stack of the template
+		if (Operation.Amount <= 0)
+		{
+			int32 itemIndex = FindStagedIndexByTemplate(StagedItems, Operation.Template);
+			while (itemIndex != INDEX_NONE)
+			{
+				if (!RemoveQuantityAt(StagedItems, itemIndex, StagedItems.Items[itemIndex].GetQuantity(), OutChanges))
+					return false;
+				itemIndex = FindStagedIndexByTemplate(StagedItems, Operation.Template);
+			}
+			return true;
+		}
+
+		// Consume matching stacks in inventory order until the requested amount is satisfied
+		int32 remainingAmount = Operation.Amount;
+		while (remainingAmount > 0)
+		{
+			const int32 itemIndex = FindStagedIndexByTemplate(StagedItems, Operation.Template);
+			if (itemIndex == INDEX_NONE)
+				return false;
+
+			const int32 amountToRemove = FMath::Min(remainingAmount, StagedItems.Items[itemIndex].GetQuantity());
+			if (!RemoveQuantityAt(StagedItems, itemIndex, amountToRemove, OutChanges))
+				return false;
+
+			remainingAmount -= amountToRemove;
+		}
+		return true;
+	}
+
+	static bool StageQuantityChange(FInventoryItemArray& StagedItems, const FInventoryTransactionOperation& Operation, TArray<FStagedChange>& OutChanges)
+	{
+		const int32 itemIndex = FindStagedIndexByGuid(StagedItems, Operation.ItemGuid);
+		if (itemIndex == INDEX_NONE)
+			return false;
+
+		if (Operation.Amount == 0)
+			return true;
+
+		if (Operation.Amount < 0)
+			return RemoveQuantityAt(StagedItems, itemIndex, -Operation.Amount, OutChanges);
+
+		auto& stagedItem = StagedItems.Items[itemIndex];
+		const int32 oldQuantity = stagedItem.GetQuantity();
+		if (!stagedItem.SetQuantity(oldQuantity + Operation.Amount))
+			return false;
+
+		OutChanges.Add({ EInventoryTransactionOperationType::EITOT_ChangeQuantity, stagedItem, oldQuantity, stagedItem.GetQuantity() });
+		return true;
+	}
+
+	/** Aggregates weight and per-category quantity changes of staged changes. */
+	static void CollectCapacityDeltas(const TArray<FStagedChange>& StagedChanges, double& OutWeightDelta, TMap<FString, int32>& OutCategoryDeltas)
+	{
+		for (const auto& stagedChange : StagedChanges)
+		{
+			const UMounteaInventoryItemTemplate* itemTemplate = stagedChange.Item.GetTemplate();
+			if (!IsValid(itemTemplate))
+				continue;
+
+			const int32 quantityDelta = stagedChange.NewQuantity - stagedChange.OldQuantity;
+			if (itemTemplate->bHasWeight)
+				OutWeightDelta += static_cast<double>(itemTemplate->Weight) * quantityDelta;
+			OutCategoryDeltas.FindOrAdd(itemTemplate->ItemCategory) += quantityDelta;
+		}
+	}
+
+	/**
+	 * Applies all operations to the staged items, stopping at the first failure.
+	 * Staged items are a working copy, so a failed transaction never touches the live inventory.
+	 */
+	static bool StageOperations(FInventoryItemArray& StagedItems, const TArray<FInventoryTransactionOperation>& Operations,
+		const TScriptInterface<IMounteaAdvancedInventoryInterface>& OwningInventory, TArray<FStagedChange>& OutChanges, FGuid& OutFailedGuid)
+	{
+		for (const auto& operation : Operations)
+		{
+			bool bStaged = false;
+			switch (operation.OperationType)
+			{
+				case EInventoryTransactionOperationType::EITOT_Add:
+					bStaged = StageAdd(StagedItems, operation.Item, OwningInventory, OutChanges);
+					break;
+				case EInventoryTransactionOperationType::EITOT_Remove:
+					bStaged = StageRemove(StagedItems, operation, OutChanges);
+					break;
+				case EInventoryTransactionOperationType::EITOT_ChangeQuantity:
+					bStaged = StageQuantityChange(StagedItems, operation, OutChanges);
+					break;
+				default:
+					break;
+			}
+
+			if (!bStaged)
+			{
+				OutFailedGuid = operation.OperationType == EInventoryTransactionOperationType::EITOT_Add ? operation.Item.GetGuid() : operation.ItemGuid;
+				return false;
+			}
+		}
+
+		CompactStagedItems(StagedItems);
+		return true;
+	}
+
+	/**
+	 * Removes moved quantities from their source inventories, one transaction per source.
+	 * Every source is validated before any of them is modified. Should a source still refuse its removal,
+	 * sources committed before it get their quantities back, so the move stays atomic.
+	 */
+	static bool CommitSourceRemovals(const TArray<FStagedChange>& StagedChanges)
+	{
+		// Several operations might move from the same source stack, amounts are aggregated per source item
+		TMap<UObject*, TMap<FGuid, int32>> sourceRemovals;
+		for (const auto& stagedChange : StagedChanges)
+		{
+			if (UObject* sourceObject = stagedChange.SourceInventory.GetObject())
+				sourceRemovals.FindOrAdd(sourceObject).FindOrAdd(stagedChange.SourceItemGuid) += stagedChange.NewQuantity - stagedChange.OldQuantity;
+		}
+
+		// Removed quantities are kept as unowned items, adding them back restores the source
+		TMap<UObject*, TArray<FInventoryTransactionOperation>> restoreOperations;
+		for (const auto& sourceRemoval : sourceRemovals)
+		{
+			TArray<FInventoryTransactionOperation>& sourceRestoreOperations = restoreOperations.Add(sourceRemoval.Key);
+			for (const auto& itemRemoval : sourceRemoval.Value)
+			{
+				FMounteaInventoryItem removedItem = IMounteaAdvancedInventoryInterface::Execute_FindItem(sourceRemoval.Key, FInventoryItemSearchParams(itemRemoval.Key));
+				if (!removedItem.IsItemValid() || removedItem.GetQuantity() < itemRemoval.Value)
+					return false;
+
+				removedItem.SetQuantity(itemRemoval.Value);
+				removedItem.SetOwningInventory(nullptr);
+				sourceRestoreOperations.Add(FInventoryTransactionOperation::MakeAdd(removedItem));
+			}
+		}
+
+		TArray<UObject*> committedSources;
+		for (const auto& sourceRemoval : sourceRemovals)
+		{
+			TArray<FInventoryTransactionOperation> removeOperations;
+			for (const auto& itemRemoval : sourceRemoval.Value)
+				removeOperations.Add(FInventoryTransactionOperation::MakeRemove(itemRemoval.Key, itemRemoval.Value));
+
+			if (IMounteaAdvancedInventoryInterface::Execute_ExecuteTransaction(sourceRemoval.Key, removeOperations))
+			{
+				committedSources.Add(sourceRemoval.Key);
+				continue;
+			}
+
+			for (UObject* committedSource : committedSources)
+			{
+				if (!IMounteaAdvancedInventoryInterface::Execute_ExecuteTransaction(committedSource, restoreOperations[committedSource]))
+					LOG_WARNING(TEXT("[CommitSourceRemovals] Failed to restore moved items to source inventory %s"), *GetNameSafe(committedSource))
+			}
+			return false;
+		}
+		return true;
+	}
+}
+
 UMounteaInventoryComponent::UMounteaInventoryComponent() : InventoryTypeFlag(EInventoryFlags::EIF_Private)
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -35,19 +318,50 @@ UMounteaInventoryComponent::UMounteaInventoryComponent() : InventoryTypeFlag(EIn
 	ComponentTags.Append( { TEXT("Mountea"), TEXT("Inventory") } );
 }
 
+void UMounteaInventoryComponent::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Replicated items do not carry their owner, array assigns it on arrival
+	InventoryItems.SetOwningInventory(this);
+}
+
 void UMounteaInventoryComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	bCapacityTotalsDirty = true;
+
+	if (!IsAuthority())
+	{
+		TemplateLoadedHandle = FMounteaInventoryTemplateRegistry::OnTemplateLoaded().AddUObject(this, &UMounteaInventoryComponent::OnTemplateLoaded);
+
+		// Only owning client can talk to server, other clients keep receiving full template references
+		if (GetOwner()->GetNetConnection())
+			VerifyTemplateRegistry_Server(static_cast<int32>(FMounteaInventoryTemplateRegistry::GetChecksum()));
+	}
+}
+
+void UMounteaInventoryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FMounteaInventoryTemplateRegistry::OnTemplateLoaded().Remove(TemplateLoadedHandle);
+	TemplateLoadedHandle.Reset();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UMounteaInventoryComponent::GetLifetimeReplicatedProps(TArray<class FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	DOREPLIFETIME_CONDITION(UMounteaInventoryComponent, InventoryItems, COND_InitialOrOwner);
+	DOREPLIFETIME_CONDITION(UMounteaInventoryComponent, CapacityLimits, COND_InitialOrOwner);
 }
 
 void UMounteaInventoryComponent::OnRep_InventoryItems()
 {
+	InventoryItems.MarkLookupsDirty();
+	bCapacityTotalsDirty = true;
+	
 	// Process replicated Items
 	// TODO refresh UI by sending Command
 	// Do I need to do anything? Maybe I dont
@@ -78,9 +392,14 @@ bool UMounteaInventoryComponent::AddItem_Implementation(const FMounteaInventoryI
 		return true;
 	}
 	
-	auto existingItem = Execute_FindItem(this, FInventoryItemSearchParams(Item.GetGuid()));
-	if (!existingItem.IsItemValid())
-		existingItem = Execute_FindItem(this, FInventoryItemSearchParams(Item.GetTemplate()));
+	int32 existingIndex = InventoryItems.FindIndexByGuid(Item.GetGuid());
+	if (existingIndex == INDEX_NONE)
+	{
+		const TArray<int32>& templateIndices = InventoryItems.FindIndicesByTemplate(Item.GetTemplate());
+		existingIndex = templateIndices.Num() > 0 ? templateIndices[0] : INDEX_NONE;
+	}
+	
+	const FMounteaInventoryItem existingItem = existingIndex != INDEX_NONE ? InventoryItems.Items[existingIndex] : FMounteaInventoryItem();
 
 	if (existingItem.IsItemValid())
 	{
@@ -145,12 +464,13 @@ bool UMounteaInventoryComponent::AddItem_Implementation(const FMounteaInventoryI
 		if (AmountToAdd != Item.GetQuantity())
 			newItem.Quantity += AmountToAdd;
 
-		InventoryItems.Items.Add(newItem);
-		InventoryItems.Items.Last().SetOwningInventory(this);
+		const int32 newIndex = InventoryItems.AddIndexedItem(newItem);
+		InventoryItems.Items[newIndex].SetOwningInventory(this);
 		InventoryItems.MarkArrayDirty();
+		UpdateCapacityTotals(newItem.GetTemplate(), newItem.GetQuantity());
 		
-		OnItemAdded.Broadcast(newItem);
-		PostItemAdded_Client(newItem);
+		OnItemAdded.Broadcast(InventoryItems.Items[newIndex]);
+		QueueItemNotification(InventoryItems.Items[newIndex], InventoryItems.Items[newIndex].GetQuantity(), true, false);
 		return true;
 	}
 
@@ -178,24 +498,24 @@ bool UMounteaInventoryComponent::RemoveItem_Implementation(const FGuid& ItemGuid
 {
 	if (!IsActive()) return false;
 	
-	const int32 ItemIndex = Execute_FindItemIndex(this, FInventoryItemSearchParams(ItemGuid));
+	const int32 ItemIndex = InventoryItems.FindIndexByGuid(ItemGuid);
 	if (ItemIndex == INDEX_NONE)
 		return false;
 
-	const FMounteaInventoryItem RemovedItem = InventoryItems.Items[ItemIndex];
-	
-	OnItemRemoved.Broadcast(RemovedItem);
-	
 	if (!IsAuthority())
 	{
 		RemoveItem_Server(ItemGuid);
 		return true;
 	}
 	
-	PostItemRemoved_Client(RemovedItem);
+	const FMounteaInventoryItem RemovedItem = InventoryItems.Items[ItemIndex];
+	
+	OnItemRemoved.Broadcast(RemovedItem);
+	QueueItemNotification(RemovedItem, -RemovedItem.GetQuantity(), false, true);
 	
-	InventoryItems.Items.RemoveAt(ItemIndex);
+	InventoryItems.RemoveIndexedItemAt(ItemIndex);
 	InventoryItems.MarkArrayDirty();
+	UpdateCapacityTotals(RemovedItem.GetTemplate(), -RemovedItem.GetQuantity());
 
 	return true;
 }
@@ -239,14 +559,24 @@ bool UMounteaInventoryComponent::CanAddItem_Implementation(const FMounteaInvento
 	if (!Item.IsItemValid() || !Item.GetTemplate())
 		return false;
 	
-	auto existingItem = Execute_FindItem(this, FInventoryItemSearchParams(Item.GetGuid()));
-	if (!existingItem.IsItemValid()) 
-		existingItem = Execute_FindItem(this, FInventoryItemSearchParams(Item.GetTemplate()));
+	int32 existingIndex = InventoryItems.FindIndexByGuid(Item.GetGuid());
+	if (existingIndex == INDEX_NONE)
+	{
+		const TArray<int32>& templateIndices = InventoryItems.FindIndicesByTemplate(Item.GetTemplate());
+		existingIndex = templateIndices.Num() > 0 ? templateIndices[0] : INDEX_NONE;
+	}
 
-	if (existingItem.IsItemValid())
-		return existingItem.GetQuantity() < existingItem.GetTemplate()->MaxQuantity;
+	if (existingIndex != INDEX_NONE && InventoryItems.Items[existingIndex].IsItemValid())
+	{
+		const auto& existingItem = InventoryItems.Items[existingIndex];
+		const int32 availableSpace = existingItem.GetTemplate()->MaxQuantity - existingItem.GetQuantity();
+		if (availableSpace <= 0)
+			return false;
+		
+		return HasCapacityFor(existingItem.GetTemplate(), FMath::Min(Item.GetQuantity(), availableSpace), 0);
+	}
 
-	return true;
+	return HasCapacityFor(Item.GetTemplate(), FMath::Min(Item.GetQuantity(), Item.GetTemplate()->MaxQuantity), 1);
 }
 
 bool UMounteaInventoryComponent::CanAddItemFromTemplate_Implementation(UMounteaInventoryItemTemplate* const Template, const int32 Quantity) const
@@ -259,7 +589,7 @@ bool UMounteaInventoryComponent::CanAddItemFromTemplate_Implementation(UMounteaI
 
 FMounteaInventoryItem UMounteaInventoryComponent::FindItem_Implementation(const FInventoryItemSearchParams& SearchParams) const
 {
-	const auto foundItem = InventoryItems.Items.FindByPredicate([&SearchParams](const FMounteaInventoryItem& Item)
+	const auto matchesSearch = [&SearchParams](const FMounteaInventoryItem& Item)
 	{
 		if (SearchParams.bSearchByGuid && Item.GetGuid() != SearchParams.ItemGuid)
 			return false;
@@ -282,14 +612,44 @@ FMounteaInventoryItem UMounteaInventoryComponent::FindItem_Implementation(const
 			return false;
 
 		return true;
-	});
+	};
+
+	// All criteria must match, so the narrowest indexed criterion gives the candidate set
+	const FMounteaInventoryItem* foundItem = nullptr;
+	if (SearchParams.bSearchByGuid)
+	{
+		const int32 itemIndex = InventoryItems.FindIndexByGuid(SearchParams.ItemGuid);
+		if (itemIndex != INDEX_NONE && matchesSearch(InventoryItems.Items[itemIndex]))
+			foundItem = &InventoryItems.Items[itemIndex];
+	}
+	else if (SearchParams.bSearchByTemplate || SearchParams.bSearchByCategory || SearchParams.bSearchByRarity)
+	{
+		const TArray<int32>& candidateIndices = SearchParams.bSearchByTemplate
+			? InventoryItems.FindIndicesByTemplate(SearchParams.Template)
+			: SearchParams.bSearchByCategory
+				? InventoryItems.FindIndicesByCategory(SearchParams.CategoryId)
+				: InventoryItems.FindIndicesByRarity(SearchParams.RarityId);
+
+		for (const int32 candidateIndex : candidateIndices)
+		{
+			if (InventoryItems.Items.IsValidIndex(candidateIndex) && matchesSearch(InventoryItems.Items[candidateIndex]))
+			{
+				foundItem = &InventoryItems.Items[candidateIndex];
+				break;
+			}
+		}
+	}
+	else
+	{
+		foundItem = InventoryItems.Items.FindByPredicate(matchesSearch);
+	}
 
 	return foundItem ? *foundItem : FMounteaInventoryItem();
 }
 
 int32 UMounteaInventoryComponent::FindItemIndex_Implementation(const FInventoryItemSearchParams& SearchParams) const
 {
-	return InventoryItems.Items.IndexOfByPredicate([&SearchParams](const FMounteaInventoryItem& Item)
+	const auto matchesSearch = [&SearchParams](const FMounteaInventoryItem& Item)
 	{
 		if (SearchParams.bSearchByGuid && Item.GetGuid() != SearchParams.ItemGuid)
 			return false;
@@ -306,7 +666,25 @@ int32 UMounteaInventoryComponent::FindItemIndex_Implementation(const FInventoryI
 		}
 
 		return true;
-	});
+	};
+
+	if (SearchParams.bSearchByGuid)
+	{
+		const int32 itemIndex = InventoryItems.FindIndexByGuid(SearchParams.ItemGuid);
+		return itemIndex != INDEX_NONE && matchesSearch(InventoryItems.Items[itemIndex]) ? itemIndex : INDEX_NONE;
+	}
+
+	if (SearchParams.bSearchByTemplate)
+	{
+		for (const int32 candidateIndex : InventoryItems.FindIndicesByTemplate(SearchParams.Template))
+		{
+			if (InventoryItems.Items.IsValidIndex(candidateIndex) && matchesSearch(InventoryItems.Items[candidateIndex]))
+				return candidateIndex;
+		}
+		return INDEX_NONE;
+	}
+	
+	return InventoryItems.Items.IndexOfByPredicate(matchesSearch);
 }
 
 TArray<FMounteaInventoryItem> UMounteaInventoryComponent::FindItems_Implementation(const FInventoryItemSearchParams& SearchParams) const
@@ -319,20 +697,21 @@ TArray<FMounteaInventoryItem> UMounteaInventoryComponent::FindItems_Implementati
 	{
 		return InventoryItems.Items;
 	}
-    
-	Algo::CopyIf(InventoryItems.Items, returnResult, [&SearchParams](const FMounteaInventoryItem& Item) -> bool
+
+	// Tags are not indexed, fall back to full scan
+	if (SearchParams.bSearchByTags)
 	{
-		if (!Item.IsItemValid())
-			return false;
-		
-		if (SearchParams.bSearchByGuid && Item.GetGuid() == SearchParams.ItemGuid)
-			return true;
+		Algo::CopyIf(InventoryItems.Items, returnResult, [&SearchParams](const FMounteaInventoryItem& Item) -> bool
+		{
+			if (!Item.IsItemValid())
+				return false;
+			
+			if (SearchParams.bSearchByGuid && Item.GetGuid() == SearchParams.ItemGuid)
+				return true;
 
-		if (SearchParams.bSearchByTemplate && Item.GetTemplate() == SearchParams.Template)
-			return true;
+			if (SearchParams.bSearchByTemplate && Item.GetTemplate() == SearchParams.Template)
+				return true;
 
-		if (SearchParams.bSearchByTags)
-		{
 			if (SearchParams.bRequireAllTags)
 			{
 				if (Item.GetCustomData().HasAll(SearchParams.Tags))
@@ -343,16 +722,47 @@ TArray<FMounteaInventoryItem> UMounteaInventoryComponent::FindItems_Implementati
 				if (Item.GetCustomData().HasAny(SearchParams.Tags))
 					return true;
 			}
-		}
 
-		if (SearchParams.bSearchByCategory && Item.GetTemplate()->ItemCategory == SearchParams.CategoryId)
-			return true;
-        
-		if (SearchParams.bSearchByRarity && Item.GetTemplate()->ItemRarity == SearchParams.RarityId)
-			return true;
+			if (SearchParams.bSearchByCategory && Item.GetTemplate()->ItemCategory == SearchParams.CategoryId)
+				return true;
+	        
+			if (SearchParams.bSearchByRarity && Item.GetTemplate()->ItemRarity == SearchParams.RarityId)
+				return true;
+			
+			return false;
+		});
 		
-		return false;
-	});
+		return returnResult;
+	}
+
+	// Any criterion can match, so the result is the union of indexed candidates in inventory order
+	TArray<int32> matchingIndices;
+	if (SearchParams.bSearchByGuid)
+	{
+		const int32 itemIndex = InventoryItems.FindIndexByGuid(SearchParams.ItemGuid);
+		if (itemIndex != INDEX_NONE)
+			matchingIndices.Add(itemIndex);
+	}
+	if (SearchParams.bSearchByTemplate)
+		matchingIndices.Append(InventoryItems.FindIndicesByTemplate(SearchParams.Template));
+	if (SearchParams.bSearchByCategory)
+		matchingIndices.Append(InventoryItems.FindIndicesByCategory(SearchParams.CategoryId));
+	if (SearchParams.bSearchByRarity)
+		matchingIndices.Append(InventoryItems.FindIndicesByRarity(SearchParams.RarityId));
+
+	matchingIndices.Sort();
+	returnResult.Reserve(matchingIndices.Num());
+	
+	int32 previousIndex = INDEX_NONE;
+	for (const int32 matchingIndex : matchingIndices)
+	{
+		if (matchingIndex == previousIndex || !InventoryItems.Items.IsValidIndex(matchingIndex))
+			continue;
+		
+		previousIndex = matchingIndex;
+		if (InventoryItems.Items[matchingIndex].IsItemValid())
+			returnResult.Add(InventoryItems.Items[matchingIndex]);
+	}
     
 	return returnResult;
 }
@@ -372,19 +782,20 @@ bool UMounteaInventoryComponent::IncreaseItemQuantity_Implementation(const FGuid
 		return true;
 	}
 	
-	const int32 index = Execute_FindItemIndex(this, FInventoryItemSearchParams(ItemGuid));
+	const int32 index = InventoryItems.FindIndexByGuid(ItemGuid);
 	if (index != INDEX_NONE && InventoryItems.Items.IsValidIndex(index))
 	{
 		auto& inventoryItem = InventoryItems.Items[index];
+		if (!HasCapacityFor(inventoryItem.GetTemplate(), Amount, 0))
+			return false;
 		
 		const int32 OldQuantity = inventoryItem.GetQuantity();
 		if (inventoryItem.SetQuantity(OldQuantity + Amount))
 		{
 			InventoryItems.MarkItemDirty(inventoryItem);
+			UpdateCapacityTotals(inventoryItem.GetTemplate(), inventoryItem.GetQuantity() - OldQuantity);
 			OnItemQuantityChanged.Broadcast(inventoryItem, OldQuantity, inventoryItem.GetQuantity());
-
-			// TODO: Don't spam client if same as server
-			PostItemQuantityChanged(inventoryItem, OldQuantity, inventoryItem.GetQuantity());
+			QueueItemNotification(inventoryItem, inventoryItem.GetQuantity() - OldQuantity, false, false);
 			return true;
 		}
 	}
@@ -401,7 +812,7 @@ bool UMounteaInventoryComponent::DecreaseItemQuantity_Implementation(const FGuid
 		return true;
 	}
 	
-	const int32 index = Execute_FindItemIndex(this, FInventoryItemSearchParams(ItemGuid));
+	const int32 index = InventoryItems.FindIndexByGuid(ItemGuid);
 	if (index != INDEX_NONE && InventoryItems.Items.IsValidIndex(index))
 	{
 		auto& inventoryItem = InventoryItems.Items[index];
@@ -415,8 +826,9 @@ bool UMounteaInventoryComponent::DecreaseItemQuantity_Implementation(const FGuid
 		if (inventoryItem.SetQuantity(NewQuantity))
 		{
 			InventoryItems.MarkItemDirty(inventoryItem);
+			UpdateCapacityTotals(inventoryItem.GetTemplate(), NewQuantity - OldQuantity);
 			OnItemQuantityChanged.Broadcast(inventoryItem, OldQuantity, NewQuantity);
-			PostItemQuantityChanged(inventoryItem, OldQuantity, NewQuantity);
+			QueueItemNotification(inventoryItem, NewQuantity - OldQuantity, false, false);
 			return true;
 		}
 	}
@@ -430,7 +842,7 @@ bool UMounteaInventoryComponent::ModifyItemDurability_Implementation(const FGuid
 	if (!IsAuthority())
 		return false;
 	
-	const int32 index = Execute_FindItemIndex(this, FInventoryItemSearchParams(ItemGuid));
+	const int32 index = InventoryItems.FindIndexByGuid(ItemGuid);
 	if (index != INDEX_NONE && InventoryItems.Items.IsValidIndex(index))
 	{
 		auto& inventoryItem = InventoryItems.Items[index];
@@ -441,7 +853,6 @@ bool UMounteaInventoryComponent::ModifyItemDurability_Implementation(const FGuid
 		{
 			InventoryItems.MarkItemDirty(inventoryItem);
 			OnItemDurabilityChanged.Broadcast(inventoryItem, OldDurability, NewDurability);
-			PostItemDurabilityChanged(inventoryItem, OldDurability, NewDurability);
 			return true;
 		}
 	}
@@ -464,8 +875,14 @@ void UMounteaInventoryComponent::ClearInventory_Implementation()
 	for (const auto& Item : InventoryItems.Items)
 	{
 		OnItemRemoved.Broadcast(Item);
+		QueueItemNotification(Item, -Item.GetQuantity(), false, true);
 	}
-	InventoryItems.Items.Empty();
+	InventoryItems.ResetIndexedItems();
+	InventoryItems.MarkArrayDirty();
+	
+	CurrentWeight = 0.0;
+	CategoryQuantities.Reset();
+	bCapacityTotalsDirty = false;
 }
 
 bool UMounteaInventoryComponent::HasItem_Implementation(const FInventoryItemSearchParams& SearchParams) const
@@ -474,6 +891,134 @@ bool UMounteaInventoryComponent::HasItem_Implementation(const FInventoryItemSear
 	return foundItem.IsItemValid();
 }
 
+bool UMounteaInventoryComponent::ExecuteTransaction_Implementation(const TArray<FInventoryTransactionOperation>& Operations)
+{
+	if (!IsActive() || Operations.Num() == 0)
+		return false;
+
+	// Validate every operation against a working copy first, live items are touched only if all of them pass
+	FInventoryItemArray stagedItems;
+	stagedItems.Items = InventoryItems.Items;
+	
+	TArray<MounteaInventoryTransaction::FStagedChange> stagedChanges;
+	FGuid failedGuid;
+	if (!MounteaInventoryTransaction::StageOperations(stagedItems, Operations, this, stagedChanges, failedGuid))
+	{
+		Execute_ProcessInventoryNotification(this, UMounteaInventoryStatics::CreateNotificationData(
+			MounteaInventoryNotificationBaseTypes::ItemNotUpdated,
+			this,
+			failedGuid,
+			0
+		));
+		return false;
+	}
+
+	double weightDelta = 0.0;
+	TMap<FString, int32> categoryDeltas;
+	MounteaInventoryTransaction::CollectCapacityDeltas(stagedChanges, weightDelta, categoryDeltas);
+	if (!HasCapacityForDeltas(weightDelta, stagedItems.Items.Num() - InventoryItems.Items.Num(), categoryDeltas))
+	{
+		Execute_ProcessInventoryNotification(this, UMounteaInventoryStatics::CreateNotificationData(
+			MounteaInventoryNotificationBaseTypes::ItemNotUpdated,
+			this,
+			FGuid(),
+			0
+		));
+		return false;
+	}
+
+	if (!IsAuthority())
+	{
+		ExecuteTransaction_Server(Operations);
+		return true;
+	}
+
+	if (!MounteaInventoryTransaction::CommitSourceRemovals(stagedChanges))
+	{
+		Execute_ProcessInventoryNotification(this, UMounteaInventoryStatics::CreateNotificationData(
+			MounteaInventoryNotificationBaseTypes::ItemNotUpdated,
+			this,
+			FGuid(),
+			0
+		));
+		return false;
+	}
+
+	InventoryItems.Items = MoveTemp(stagedItems.Items);
+	InventoryItems.MarkLookupsDirty();
+	
+	for (const auto& stagedChange : stagedChanges)
+	{
+		UpdateCapacityTotals(stagedChange.Item.GetTemplate(), stagedChange.NewQuantity - stagedChange.OldQuantity);
+		
+		if (stagedChange.Type == EInventoryTransactionOperationType::EITOT_Remove)
+			continue;
+		
+		const int32 itemIndex = InventoryItems.FindIndexByGuid(stagedChange.Item.GetGuid());
+		if (itemIndex != INDEX_NONE)
+			InventoryItems.MarkItemDirty(InventoryItems.Items[itemIndex]);
+	}
+	InventoryItems.MarkArrayDirty();
+
+	for (const auto& stagedChange : stagedChanges)
+	{
+		switch (stagedChange.Type)
+		{
+			case EInventoryTransactionOperationType::EITOT_Add:
+				OnItemAdded.Broadcast(stagedChange.Item);
+				QueueItemNotification(stagedChange.Item, stagedChange.NewQuantity, true, false);
+				break;
+			case EInventoryTransactionOperationType::EITOT_Remove:
+				OnItemRemoved.Broadcast(stagedChange.Item);
+				QueueItemNotification(stagedChange.Item, -stagedChange.OldQuantity, false, true);
+				break;
+			case EInventoryTransactionOperationType::EITOT_ChangeQuantity:
+				OnItemQuantityChanged.Broadcast(stagedChange.Item, stagedChange.OldQuantity, stagedChange.NewQuantity);
+				QueueItemNotification(stagedChange.Item, stagedChange.NewQuantity - stagedChange.OldQuantity, false, false);
+				break;
+			default:
+				break;
+		}
+	}
+
+	return true;
+}
+
+FInventoryCapacityLimits UMounteaInventoryComponent::GetCapacityLimits_Implementation() const
+{
+	return CapacityLimits;
+}
+
+void UMounteaInventoryComponent::SetCapacityLimits_Implementation(const FInventoryCapacityLimits& NewLimits)
+{
+	if (!IsAuthority())
+		return;
+	
+	CapacityLimits = NewLimits;
+}
+
+float UMounteaInventoryComponent::GetCurrentWeight_Implementation() const
+{
+	if (bCapacityTotalsDirty)
+		RebuildCapacityTotals();
+	
+	return static_cast<float>(CurrentWeight);
+}
+
+int32 UMounteaInventoryComponent::GetOccupiedSlots_Implementation() const
+{
+	return InventoryItems.Items.Num();
+}
+
+int32 UMounteaInventoryComponent::GetCategoryQuantity_Implementation(const FString& CategoryId) const
+{
+	if (bCapacityTotalsDirty)
+		RebuildCapacityTotals();
+	
+	const int32* categoryQuantity = CategoryQuantities.Find(CategoryId);
+	return categoryQuantity ? *categoryQuantity : 0;
+}
+
 void UMounteaInventoryComponent::ProcessInventoryNotification_Implementation(const FInventoryNotificationData& Notification)
 {
 	if (!Notification.NotificationConfig.bIsEnabled)
@@ -500,6 +1045,109 @@ bool UMounteaInventoryComponent::IsAuthority() const
 	return false;
 }
 
+bool UMounteaInventoryComponent::HasCapacityFor(const UMounteaInventoryItemTemplate* Template, const int32 QuantityDelta, const int32 SlotDelta) const
+{
+	if (!IsValid(Template))
+		return false;
+
+	if (CapacityLimits.bLimitSlots && SlotDelta > 0 && InventoryItems.Items.Num() + SlotDelta > CapacityLimits.MaxSlots)
+		return false;
+
+	if (QuantityDelta <= 0)
+		return true;
+
+	if (bCapacityTotalsDirty)
+		RebuildCapacityTotals();
+
+	if (CapacityLimits.bLimitWeight && Template->bHasWeight
+		&& CurrentWeight + static_cast<double>(Template->Weight) * QuantityDelta > CapacityLimits.MaxWeight + KINDA_SMALL_NUMBER)
+		return false;
+
+	if (CapacityLimits.bLimitCategories)
+	{
+		if (const int32* categoryLimit = CapacityLimits.CategoryLimits.Find(Template->ItemCategory))
+		{
+			const int32* categoryQuantity = CategoryQuantities.Find(Template->ItemCategory);
+			if ((categoryQuantity ? *categoryQuantity : 0) + QuantityDelta > *categoryLimit)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+bool UMounteaInventoryComponent::HasCapacityForDeltas(const double WeightDelta, const int32 SlotDelta, const TMap<FString, int32>& CategoryDeltas) const
+{
+	if (CapacityLimits.bLimitSlots && SlotDelta > 0 && InventoryItems.Items.Num() + SlotDelta > CapacityLimits.MaxSlots)
+		return false;
+
+	if (bCapacityTotalsDirty)
+		RebuildCapacityTotals();
+
+	if (CapacityLimits.bLimitWeight && WeightDelta > 0.0 && CurrentWeight + WeightDelta > CapacityLimits.MaxWeight + KINDA_SMALL_NUMBER)
+		return false;
+
+	if (CapacityLimits.bLimitCategories)
+	{
+		for (const auto& categoryDelta : CategoryDeltas)
+		{
+			if (categoryDelta.Value <= 0)
+				continue;
+			
+			if (const int32* categoryLimit = CapacityLimits.CategoryLimits.Find(categoryDelta.Key))
+			{
+				const int32* categoryQuantity = CategoryQuantities.Find(categoryDelta.Key);
+				if ((categoryQuantity ? *categoryQuantity : 0) + categoryDelta.Value > *categoryLimit)
+					return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void UMounteaInventoryComponent::UpdateCapacityTotals(const UMounteaInventoryItemTemplate* Template, const int32 QuantityDelta)
+{
+	// Dirty totals are rebuilt from scratch on next query, no need to track changes
+	if (bCapacityTotalsDirty || !IsValid(Template) || QuantityDelta == 0)
+		return;
+
+	// Prevent floating point drift from accumulating over inventory lifetime
+	if (InventoryItems.Items.Num() == 0)
+	{
+		CurrentWeight = 0.0;
+		CategoryQuantities.Reset();
+		return;
+	}
+
+	if (Template->bHasWeight)
+		CurrentWeight += static_cast<double>(Template->Weight) * QuantityDelta;
+
+	int32& categoryQuantity = CategoryQuantities.FindOrAdd(Template->ItemCategory);
+	categoryQuantity += QuantityDelta;
+	if (categoryQuantity <= 0)
+		CategoryQuantities.Remove(Template->ItemCategory);
+}
+
+void UMounteaInventoryComponent::RebuildCapacityTotals() const
+{
+	CurrentWeight = 0.0;
+	CategoryQuantities.Reset();
+
+	for (const auto& inventoryItem : InventoryItems.Items)
+	{
+		const UMounteaInventoryItemTemplate* itemTemplate = inventoryItem.GetTemplate();
+		if (!IsValid(itemTemplate))
+			continue;
+
+		if (itemTemplate->bHasWeight)
+			CurrentWeight += static_cast<double>(itemTemplate->Weight) * inventoryItem.GetQuantity();
+		CategoryQuantities.FindOrAdd(itemTemplate->ItemCategory) += inventoryItem.GetQuantity();
+	}
+
+	bCapacityTotalsDirty = false;
+}
+
 void UMounteaInventoryComponent::ChangeItemQuantity_Server_Implementation(const FGuid& ItemGuid, const int32 DeltaAmount)
 {
 	if (DeltaAmount < 0)
@@ -534,52 +1182,95 @@ void UMounteaInventoryComponent::RemoveItem_Server_Implementation(const FGuid& I
 	Execute_RemoveItem(this, ItemGuid);
 }
 
-void UMounteaInventoryComponent::PostItemAdded_Client_Implementation(const FMounteaInventoryItem& Item)
+void UMounteaInventoryComponent::ExecuteTransaction_Server_Implementation(const TArray<FInventoryTransactionOperation>& Operations)
 {
-	if (IsAuthority() && UMounteaInventorySystemStatics::CanExecuteCosmeticEvents(GetWorld()))
+	Execute_ExecuteTransaction(this, Operations);
+}
+
+void UMounteaInventoryComponent::VerifyTemplateRegistry_Server_Implementation(const int32 ClientChecksum)
+{
+	if (static_cast<uint32>(ClientChecksum) != FMounteaInventoryTemplateRegistry::GetChecksum())
 	{
-		Execute_ProcessInventoryNotification(this, UMounteaInventoryStatics::CreateNotificationData(
-				MounteaInventoryNotificationBaseTypes::ItemAdded,
-				this,
-				Item.GetGuid(),
-				Item.Quantity
-			));
+		LOG_WARNING(TEXT("[Template Registry] Client template registry does not match server one, templates are replicated as full references!"))
+		return;
 	}
-	
-	OnItemAdded.Broadcast(Item);
+
+	FMounteaInventoryTemplateRegistry::SetConnectionVerified(GetOwner()->GetNetConnection());
+	ConfirmTemplateRegistry_Client();
+}
+
+void UMounteaInventoryComponent::ConfirmTemplateRegistry_Client_Implementation()
+{
+	FMounteaInventoryTemplateRegistry::SetConnectionVerified(GetOwner()->GetNetConnection());
 }
 
-void UMounteaInventoryComponent::PostItemRemoved_Client_Implementation(const FMounteaInventoryItem& Item)
+void UMounteaInventoryComponent::OnTemplateLoaded(const int32 TemplateIndex, UMounteaInventoryItemTemplate* LoadedTemplate)
 {
-	if (IsAuthority() && UMounteaInventorySystemStatics::CanExecuteCosmeticEvents(GetWorld()))
+	TArray<int32> resolvedIndices;
+	for (int32 i = 0; i < InventoryItems.Items.Num(); ++i)
 	{
-		Execute_ProcessInventoryNotification(this, UMounteaInventoryStatics::CreateNotificationData(
-				MounteaInventoryNotificationBaseTypes::ItemRemoved,
-				this,
-				Item.GetGuid(),
-				Item.GetQuantity()
-			));
+		if (InventoryItems.Items[i].ResolvePendingTemplate(TemplateIndex, LoadedTemplate))
+			resolvedIndices.Add(i);
 	}
-	
-	OnItemRemoved.Broadcast(Item);
+
+	if (resolvedIndices.IsEmpty())
+		return;
+
+	InventoryItems.MarkLookupsDirty();
+	bCapacityTotalsDirty = true;
+
+	// Add events were held back while the template was loading
+	for (const int32 resolvedIndex : resolvedIndices)
+		InventoryItems.Items[resolvedIndex].PostReplicatedAdd(InventoryItems);
 }
 
-void UMounteaInventoryComponent::PostItemQuantityChanged_Implementation(const FMounteaInventoryItem& Item, const int32 OldQuantity, const int32 NewQuantity)
+void UMounteaInventoryComponent::QueueItemNotification(const FMounteaInventoryItem& Item, const int32 QuantityDelta, const bool bAdded, const bool bRemoved)
 {
-	if (IsAuthority() && UMounteaInventorySystemStatics::CanExecuteCosmeticEvents(GetWorld()))
+	// Dedicated servers have nobody to notify, remote clients are notified by item replication
+	if (!IsAuthority() || !UMounteaInventorySystemStatics::CanExecuteCosmeticEvents(GetWorld()))
+		return;
+
+	auto& pendingNotification = PendingNotifications.FindOrAdd(Item.GetGuid());
+	pendingNotification.Item = Item;
+	pendingNotification.QuantityDelta += QuantityDelta;
+	pendingNotification.bAdded |= bAdded;
+	pendingNotification.bRemoved |= bRemoved;
+
+	if (!bNotificationFlushScheduled)
 	{
-		Execute_ProcessInventoryNotification(this, UMounteaInventoryStatics::CreateNotificationData(
-				OldQuantity > NewQuantity ? MounteaInventoryNotificationBaseTypes::ItemRemoved : MounteaInventoryNotificationBaseTypes::ItemAdded,
-				this,
-				Item.GetGuid(),
-				OldQuantity > NewQuantity ? FMath::Abs(OldQuantity - NewQuantity) : -FMath::Abs(OldQuantity - NewQuantity)
-			));
+		bNotificationFlushScheduled = true;
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UMounteaInventoryComponent::FlushItemNotifications);
 	}
-	
-	OnItemQuantityChanged.Broadcast(Item, OldQuantity, NewQuantity);
 }
 
-void UMounteaInventoryComponent::PostItemDurabilityChanged_Implementation(const FMounteaInventoryItem& Item, const int32 OldDurability, const int32 NewDurability)
+void UMounteaInventoryComponent::FlushItemNotifications()
 {
-	OnItemDurabilityChanged.Broadcast(Item, OldDurability, NewDurability);
+	bNotificationFlushScheduled = false;
+	
+	const TMap<FGuid, FInventoryPendingNotification> pendingNotifications = MoveTemp(PendingNotifications);
+	PendingNotifications.Reset();
+	
+	for (const auto& pendingNotification : pendingNotifications)
+	{
+		const FInventoryPendingNotification& notification = pendingNotification.Value;
+
+		// Item which was added and removed within the same frame was never visible
+		if (notification.bAdded && notification.bRemoved)
+			continue;
+		
+		FString notificationType;
+		if (notification.bRemoved || (!notification.bAdded && notification.QuantityDelta < 0))
+			notificationType = MounteaInventoryNotificationBaseTypes::ItemRemoved;
+		else if (notification.bAdded || notification.QuantityDelta > 0)
+			notificationType = MounteaInventoryNotificationBaseTypes::ItemAdded;
+		else
+			continue;
+
+		Execute_ProcessInventoryNotification(this, UMounteaInventoryStatics::CreateNotificationData(
+			notificationType,
+			this,
+			notification.Item,
+			notification.QuantityDelta
+		));
+	}
 }
\ No newline at end of file
@@ -12,6 +12,7 @@
 
 #include "Definitions/MounteaAdvancedAttachmentSlotBase.h"
 
+#include "Components/MounteaAttachmentContainerComponent.h"
 #include "Definitions/MounteaEquipmentBaseEnums.h"
 #include "Interfaces/Attachments/MounteaAdvancedAttachmentAttachableInterface.h"
 #include "Interfaces/Attachments/MounteaAdvancedAttachmentContainerInterface.h"
@@ -248,6 +249,9 @@ void UMounteaAdvancedAttachmentSlotBase::PostEditChangeProperty(struct FProperty
 	const FName propertName = (PropertyChangedEvent.Property != nullptr) ? PropertyChangedEvent.Property->GetFName() : NAME_None;
 	if (propertName == GET_MEMBER_NAME_CHECKED(UMounteaAdvancedAttachmentSlotBase, SlotName))
 	{
+		if (UMounteaAttachmentContainerComponent* parentContainer = GetTypedOuter<UMounteaAttachmentContainerComponent>())
+			parentContainer->MarkSlotIndicesDirty();
+
 		if (IsValid(equipmentConfig))
 		{
 			if (const FMounteaEquipmentSlotHeaderData* headerData = equipmentConfig->AllowedEquipmentSlots.Find(SlotName))
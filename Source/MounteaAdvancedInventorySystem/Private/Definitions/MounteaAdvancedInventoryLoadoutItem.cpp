@@ -27,6 +27,17 @@ UMounteaAdvancedInventoryLoadoutItem::UMounteaAdvancedInventoryLoadoutItem() :
 #endif
 }
 
+int32 UMounteaAdvancedInventoryLoadoutItem::ResolveQuantity(FRandomStream& RandomStream) const
+{
+	if (!bUseRandomQuantity)
+		return BaseQuantity;
+
+	const int32 maxQuantity = IsValid(ItemTemplate) ? FMath::Max(1, ItemTemplate->MaxQuantity) : MAX_int32;
+	const int32 rangeMin = FMath::Clamp(FMath::Min(RandomRange.X, RandomRange.Y), 1, maxQuantity);
+	const int32 rangeMax = FMath::Clamp(FMath::Max(RandomRange.X, RandomRange.Y), rangeMin, maxQuantity);
+	return RandomStream.RandRange(rangeMin, rangeMax);
+}
+
 TArray<FName> UMounteaAdvancedInventoryLoadoutItem::GetAvailableSlotNames()
 {
 	const auto equipmentConfig = UMounteaEquipmentStatics::GetEquipmentSettingsConfig();
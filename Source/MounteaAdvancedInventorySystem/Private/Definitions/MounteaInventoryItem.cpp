@@ -14,6 +14,9 @@
 
 #include "Definitions/MounteaInventoryBaseEnums.h"
 #include "Definitions/MounteaInventoryItemTemplate.h"
+#include "Helpers/MounteaInventoryTemplateRegistry.h"
+#include "Math/Float16.h"
+#include "Serialization/BitReader.h"
 #include "Interfaces/Inventory/MounteaAdvancedInventoryInterface.h"
 #include "Statics/MounteaInventoryStatics.h"
 
@@ -233,59 +236,205 @@ bool FMounteaInventoryItem::SetOwningInventory(const TScriptInterface<IMounteaAd
 	return true;
 }
 
-bool FMounteaInventoryItem::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+bool FMounteaInventoryItem::ResolvePendingTemplate(const int32 TemplateIndex, UMounteaInventoryItemTemplate* InTemplate)
 {
-	Ar << Guid;
-	Ar << Template;
-	Ar << Quantity;
-	Ar << Durability;
-	CustomData.NetSerialize(Ar, Map, bOutSuccess);
+	if (PendingTemplateIndex == INDEX_NONE || PendingTemplateIndex != TemplateIndex || !IsValid(InTemplate))
+		return false;
 
-	// Handle TScriptInterface serialization
-	UObject* OwningInventoryObj = nullptr;
-	if (Ar.IsSaving())
-		OwningInventoryObj = OwningInventory.GetObject();
-	Ar << OwningInventoryObj;
-	if (Ar.IsLoading())
-		OwningInventory = TScriptInterface<IMounteaAdvancedInventoryInterface>(OwningInventoryObj);
+	Template = InTemplate;
+	PendingTemplateIndex = INDEX_NONE;
+	return true;
+}
 
-	if (Ar.IsLoading())
-		AffectorSlots.Empty();
+namespace MounteaInventoryItemNetSerialization
+{
+	/** Flags describing which optional fields follow in the serialized item. */
+	enum EItemNetFields : uint8
+	{
+		INF_IndexedTemplate		= 1 << 0,
+		INF_HalfDurability		= 1 << 1,
+		INF_RawDurability		= 1 << 2,
+		INF_CustomData			= 1 << 3,
+		INF_AffectorSlots		= 1 << 4,
+		INF_OwningInventory		= 1 << 5
+	};
+	
+	constexpr uint32 NumFieldBits = 6;
+
+	/** Largest durability representable as half float, bigger values are sent raw. */
+	constexpr float MaxHalfDurability = 65504.f;
+
+	/** Upper limit of affector slots accepted from network, count is read before anything is allocated. */
+	constexpr uint32 MaxNetAffectorSlots = 64;
+
+	/** Every affector slot carries at least its Guid. */
+	constexpr int64 MinAffectorSlotBits = sizeof(FGuid) * 8;
+}
+
+bool FMounteaInventoryItem::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace MounteaInventoryItemNetSerialization;
+	
+	bOutSuccess = true;
+	
+	uint8 fieldFlags = 0;
+	int32 templateIndex = INDEX_NONE;
+	if (Ar.IsSaving())
+	{
+		// Indices are sent only to peers which confirmed the same registry. Only replicated array replays
+		// items once their template finishes loading, RPC parameters therefore always carry full reference.
+		if (bNetSerializingInArray && FMounteaInventoryTemplateRegistry::CanUseIndices(Map))
+			templateIndex = FMounteaInventoryTemplateRegistry::GetTemplateIndex(Template);
+		if (templateIndex != INDEX_NONE)
+			fieldFlags |= INF_IndexedTemplate;
 		
-	int32 NumPairs = AffectorSlots.Num();
-	Ar << NumPairs;
+		if (IsValid(Template) && Template->bHasDurability && FMath::Abs(Durability) <= MaxHalfDurability)
+			fieldFlags |= INF_HalfDurability;
+		else if (!FMath::IsNearlyEqual(Durability, 1.f))
+			fieldFlags |= INF_RawDurability;
+		
+		if (!CustomData.IsEmpty())
+			fieldFlags |= INF_CustomData;
+		if (AffectorSlots.Num() > 0)
+			fieldFlags |= INF_AffectorSlots;
+		if (!bNetSerializingInArray && OwningInventory.GetObject())
+			fieldFlags |= INF_OwningInventory;
+	}
+	
+	Ar.SerializeBits(&fieldFlags, NumFieldBits);
+	Ar << Guid;
 
-	if (Ar.IsLoading())
+	// Template
+	if (fieldFlags & INF_IndexedTemplate)
 	{
-		for (int32 i = 0; i < NumPairs; ++i)
+		uint32 packedIndex = static_cast<uint32>(templateIndex);
+		Ar.SerializeIntPacked(packedIndex);
+		if (Ar.IsLoading())
 		{
-			FGameplayTag Key;
-			FGuid Value;
-			Ar << Key;
-			Ar << Value;
-			AffectorSlots.Add(Key, Value);
+			// Template which is not loaded yet is assigned once its async load finishes
+			bool bTemplatePending = false;
+			Template = FMounteaInventoryTemplateRegistry::GetTemplateByIndex(static_cast<int32>(packedIndex), bTemplatePending);
+			PendingTemplateIndex = bTemplatePending ? static_cast<int32>(packedIndex) : INDEX_NONE;
+			bOutSuccess &= Template != nullptr || bTemplatePending;
 		}
 	}
 	else
 	{
-		for (const auto& Pair : AffectorSlots)
+		Ar << Template;
+		if (Ar.IsLoading())
+			PendingTemplateIndex = INDEX_NONE;
+	}
+
+	// Quantity
+	uint32 packedQuantity = static_cast<uint32>(Quantity);
+	Ar.SerializeIntPacked(packedQuantity);
+	if (Ar.IsLoading())
+		Quantity = static_cast<int32>(packedQuantity);
+
+	// Durability as half float, decoding must not depend on template which might still be loading
+	if (fieldFlags & INF_HalfDurability)
+	{
+		FFloat16 halfDurability(Durability);
+		Ar << halfDurability;
+		if (Ar.IsLoading())
+			Durability = halfDurability.GetFloat();
+	}
+	else if (fieldFlags & INF_RawDurability)
+	{
+		Ar << Durability;
+	}
+	else if (Ar.IsLoading())
+	{
+		Durability = 1.f;
+	}
+
+	// Custom Data
+	if (fieldFlags & INF_CustomData)
+	{
+		bool bCustomDataSuccess = true;
+		CustomData.NetSerialize(Ar, Map, bCustomDataSuccess);
+		bOutSuccess &= bCustomDataSuccess;
+	}
+	else if (Ar.IsLoading())
+	{
+		CustomData.Reset();
+	}
+
+	// Affector Slots
+	if (Ar.IsLoading())
+		AffectorSlots.Reset();
+	
+	if (fieldFlags & INF_AffectorSlots)
+	{
+		uint32 numPairs = FMath::Min(static_cast<uint32>(AffectorSlots.Num()), MaxNetAffectorSlots);
+		Ar.SerializeIntPacked(numPairs);
+
+		if (Ar.IsLoading())
+		{
+			// Count comes from remote peer, it must fit both the limit and the data actually received.
+			// Net archives are bit archives, other readers are bound by the limit and their error state.
+			const int64 bitsLeft = Ar.IsNetArchive() ? static_cast<FBitReader&>(Ar).GetBitsLeft() : MAX_int64;
+			if (numPairs > MaxNetAffectorSlots || static_cast<int64>(numPairs) * MinAffectorSlotBits > bitsLeft)
+			{
+				Ar.SetError();
+				bOutSuccess = false;
+				return true;
+			}
+
+			AffectorSlots.Reserve(numPairs);
+			for (uint32 i = 0; i < numPairs && !Ar.IsError(); ++i)
+			{
+				FGameplayTag slotTag;
+				FGuid slotGuid;
+				bool bTagSuccess = true;
+				slotTag.NetSerialize(Ar, Map, bTagSuccess);
+				Ar << slotGuid;
+				bOutSuccess &= bTagSuccess;
+				AffectorSlots.Add(slotTag, slotGuid);
+			}
+		}
+		else
 		{
-			FGameplayTag Key = Pair.Key;
-			FGuid Value = Pair.Value;
-			Ar << Key;
-			Ar << Value;
+			uint32 numWrittenPairs = 0;
+			for (const auto& affectorSlot : AffectorSlots)
+			{
+				if (numWrittenPairs++ >= numPairs)
+					break;
+
+				FGameplayTag slotTag = affectorSlot.Key;
+				FGuid slotGuid = affectorSlot.Value;
+				bool bTagSuccess = true;
+				slotTag.NetSerialize(Ar, Map, bTagSuccess);
+				Ar << slotGuid;
+			}
 		}
 	}
+
+	// Owning Inventory, receiver of replicated array knows it already
+	if (fieldFlags & INF_OwningInventory)
+	{
+		UObject* owningInventoryObject = OwningInventory.GetObject();
+		Ar << owningInventoryObject;
+		if (Ar.IsLoading())
+			OwningInventory = TScriptInterface<IMounteaAdvancedInventoryInterface>(owningInventoryObject);
+	}
 	
-	bOutSuccess = true;
+	bOutSuccess &= !Ar.IsError();
 	return true;
 }
 
 void FMounteaInventoryItem::PostReplicatedAdd(const struct FInventoryItemArray& InArraySerializer)
 {
+	if (!IsValid(OwningInventory.GetObject()))
+		OwningInventory = InArraySerializer.GetOwningInventory();
+	
 	if (IsValid(OwningInventory.GetObject()))
 	{
 		CapturePreReplicationSnapshot();
+
+		// Owning inventory replays this once the template is loaded
+		if (IsTemplatePending())
+			return;
 		
 		OwningInventory->Execute_ProcessInventoryNotification
 		(
@@ -297,16 +446,26 @@ void FMounteaInventoryItem::PostReplicatedAdd(const struct FInventoryItemArray&
 				Quantity
 			)
 		);
+
+		// Events are derived from replication, so server does not need to send any RPC per change
+		if (IMounteaAdvancedInventoryInterface* inventoryInterface = OwningInventory.GetInterface())
+			inventoryInterface->GetOnItemAddedEventHandle().Broadcast(*this);
 	}
 }
 
 void FMounteaInventoryItem::PostReplicatedChange(const FInventoryItemArray& InArraySerializer)
 {
+	if (!IsValid(OwningInventory.GetObject()))
+		OwningInventory = InArraySerializer.GetOwningInventory();
+	
 	if (!IsValid(OwningInventory.GetObject()))
 	{
 		return;
 	}
 
+	if (IsTemplatePending())
+		return;
+
 	if (!IsValid(Template))
 	{
 		LOG_ERROR(TEXT("[Inventory Item Client Update] Invalid Template! Aborting!"))
@@ -330,6 +489,9 @@ void FMounteaInventoryItem::PostReplicatedChange(const FInventoryItemArray& InAr
 				QuantityDelta > 0 ? QuantityDelta : -QuantityDelta
 			)
 		);
+
+		if (IMounteaAdvancedInventoryInterface* inventoryInterface = OwningInventory.GetInterface())
+			inventoryInterface->GetOnItemQuantityChangedEventHandle().Broadcast(*this, Quantity - QuantityDelta, Quantity);
 	}
 
 	if (Template->bHasDurability)
@@ -338,6 +500,9 @@ void FMounteaInventoryItem::PostReplicatedChange(const FInventoryItemArray& InAr
 		if (PreReplicationSnapshot.HasDurabilityChanged(*this))
 		{
 			const float DurabilityDelta = PreReplicationSnapshot.GetDurabilityDelta(*this);
+			if (IMounteaAdvancedInventoryInterface* inventoryInterface = OwningInventory.GetInterface())
+				inventoryInterface->GetOnItemDurabilityChangedEventHandle().Broadcast(*this, Durability - DurabilityDelta, Durability);
+			
 			if (DurabilityDelta > 0)
 			{
 				// If the increased durability reaches the maximum, notify accordingly.
@@ -403,6 +568,9 @@ void FMounteaInventoryItem::PostReplicatedChange(const FInventoryItemArray& InAr
 
 void FMounteaInventoryItem::PreReplicatedRemove(const struct FInventoryItemArray& InArraySerializer)
 {
+	if (!IsValid(OwningInventory.GetObject()))
+		OwningInventory = InArraySerializer.GetOwningInventory();
+	
 	if (IsValid(OwningInventory.GetObject()))
 	{
 		OwningInventory->Execute_ProcessInventoryNotification
@@ -415,5 +583,205 @@ void FMounteaInventoryItem::PreReplicatedRemove(const struct FInventoryItemArray
 				-Quantity
 			)
 		);
+
+		if (IMounteaAdvancedInventoryInterface* inventoryInterface = OwningInventory.GetInterface())
+			inventoryInterface->GetOnItemRemovedEventHandle().Broadcast(*this);
 	}
 }
+
+bool FInventoryItemArray::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
+{
+	// Items learn they are serialized by the array, so they can rely on its owner and template replay
+	for (FMounteaInventoryItem& item : Items)
+		item.bNetSerializingInArray = true;
+
+	const bool bResult = FastArrayDeltaSerialize<FMounteaInventoryItem>(Items, DeltaParams, *this);
+
+	for (FMounteaInventoryItem& item : Items)
+		item.bNetSerializingInArray = false;
+	return bResult;
+}
+
+void FInventoryItemArray::SetOwningInventory(const TScriptInterface<IMounteaAdvancedInventoryInterface>& InOwningInventory)
+{
+	OwningInventoryObject = InOwningInventory.GetObject();
+}
+
+TScriptInterface<IMounteaAdvancedInventoryInterface> FInventoryItemArray::GetOwningInventory() const
+{
+	return TScriptInterface<IMounteaAdvancedInventoryInterface>(OwningInventoryObject.Get());
+}
+
+int32 FInventoryItemArray::AddIndexedItem(const FMounteaInventoryItem& Item)
+{
+	RebuildLookupsIfDirty();
+
+	const int32 newIndex = Items.Add(Item);
+	RegisterLookup(newIndex);
+	LookupsItemCount = Items.Num();
+	return newIndex;
+}
+
+void FInventoryItemArray::RemoveIndexedItemAt(const int32 Index)
+{
+	if (!Items.IsValidIndex(Index))
+		return;
+
+	RebuildLookupsIfDirty();
+	UnregisterLookup(Index);
+
+	Items.RemoveAt(Index);
+	LookupsItemCount = Items.Num();
+}
+
+void FInventoryItemArray::ResetIndexedItems()
+{
+	Items.Empty();
+	GuidLookup.Empty();
+	TemplateLookup.Empty();
+	CategoryLookup.Empty();
+	RarityLookup.Empty();
+	LookupsItemCount = 0;
+	bLookupsDirty = false;
+}
+
+int32 FInventoryItemArray::FindIndexByGuid(const FGuid& ItemGuid) const
+{
+	RebuildLookupsIfDirty();
+
+	const int32* foundIndex = GuidLookup.Find(ItemGuid);
+	if (!foundIndex)
+		return INDEX_NONE;
+
+	// Items might have been modified outside of the indexed API, validate before trusting the lookup
+	if (Items.IsValidIndex(*foundIndex) && Items[*foundIndex].GetGuid() == ItemGuid)
+		return *foundIndex;
+
+	MarkLookupsDirty();
+	RebuildLookupsIfDirty();
+	foundIndex = GuidLookup.Find(ItemGuid);
+	return foundIndex ? *foundIndex : INDEX_NONE;
+}
+
+const TArray<int32>& FInventoryItemArray::FindIndicesByTemplate(const UMounteaInventoryItemTemplate* Template) const
+{
+	static const TArray<int32> EmptyIndices;
+	RebuildLookupsIfDirty();
+
+	const TArray<int32>* foundIndices = TemplateLookup.Find(Template);
+	return foundIndices ? *foundIndices : EmptyIndices;
+}
+
+const TArray<int32>& FInventoryItemArray::FindIndicesByCategory(const FString& CategoryId) const
+{
+	static const TArray<int32> EmptyIndices;
+	RebuildLookupsIfDirty();
+
+	const TArray<int32>* foundIndices = CategoryLookup.Find(CategoryId);
+	return foundIndices ? *foundIndices : EmptyIndices;
+}
+
+const TArray<int32>& FInventoryItemArray::FindIndicesByRarity(const FString& RarityId) const
+{
+	static const TArray<int32> EmptyIndices;
+	RebuildLookupsIfDirty();
+
+	const TArray<int32>* foundIndices = RarityLookup.Find(RarityId);
+	return foundIndices ? *foundIndices : EmptyIndices;
+}
+
+void FInventoryItemArray::PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize)
+{
+	// Fast Array removes by swapping, so every remaining slot can move
+	MarkLookupsDirty();
+}
+
+void FInventoryItemArray::PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize)
+{
+	if (bLookupsDirty)
+		return;
+
+	for (const int32 addedIndex : AddedIndices)
+	{
+		if (!Items.IsValidIndex(addedIndex))
+			continue;
+
+		// Item callbacks run first and might have rebuilt the lookups with this item already
+		const int32* registeredIndex = GuidLookup.Find(Items[addedIndex].GetGuid());
+		if (registeredIndex && *registeredIndex == addedIndex)
+			continue;
+
+		RegisterLookup(addedIndex);
+	}
+
+	LookupsItemCount = Items.Num();
+}
+
+void FInventoryItemArray::RegisterLookup(const int32 Index) const
+{
+	if (!Items.IsValidIndex(Index))
+		return;
+
+	const FMounteaInventoryItem& item = Items[Index];
+	GuidLookup.Add(item.GetGuid(), Index);
+
+	const UMounteaInventoryItemTemplate* itemTemplate = item.GetTemplate();
+	if (!IsValid(itemTemplate))
+		return;
+
+	TemplateLookup.FindOrAdd(itemTemplate).Add(Index);
+	CategoryLookup.FindOrAdd(itemTemplate->ItemCategory).Add(Index);
+	RarityLookup.FindOrAdd(itemTemplate->ItemRarity).Add(Index);
+}
+
+void FInventoryItemArray::UnregisterLookup(const int32 Index) const
+{
+	GuidLookup.Remove(Items[Index].GetGuid());
+	for (TPair<FGuid, int32>& guidIndex : GuidLookup)
+	{
+		if (guidIndex.Value > Index)
+			--guidIndex.Value;
+	}
+
+	const auto shiftIndices = [Index](auto& Lookup)
+	{
+		for (auto lookupIt = Lookup.CreateIterator(); lookupIt; ++lookupIt)
+		{
+			TArray<int32>& indices = lookupIt.Value();
+			indices.Remove(Index);
+			if (indices.IsEmpty())
+			{
+				lookupIt.RemoveCurrent();
+				continue;
+			}
+
+			for (int32& itemIndex : indices)
+			{
+				if (itemIndex > Index)
+					--itemIndex;
+			}
+		}
+	};
+
+	shiftIndices(TemplateLookup);
+	shiftIndices(CategoryLookup);
+	shiftIndices(RarityLookup);
+}
+
+void FInventoryItemArray::RebuildLookupsIfDirty() const
+{
+	if (!bLookupsDirty && LookupsItemCount == Items.Num())
+		return;
+
+	GuidLookup.Reset();
+	TemplateLookup.Reset();
+	CategoryLookup.Reset();
+	RarityLookup.Reset();
+	GuidLookup.Reserve(Items.Num());
+
+	for (int32 i = 0; i < Items.Num(); ++i)
+		RegisterLookup(i);
+
+	LookupsItemCount = Items.Num();
+	bLookupsDirty = false;
+}
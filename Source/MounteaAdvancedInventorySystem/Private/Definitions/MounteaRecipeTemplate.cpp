@@ -12,10 +12,45 @@
 
 #include "Definitions/MounteaRecipeTemplate.h"
 
+#include "Definitions/MounteaInventoryItemTemplate.h"
 #include "Definitions/MounteaRecipeIngredientsList.h"
+#include "UObject/ObjectSaveContext.h"
 
 #if WITH_EDITOR
 
+void UMounteaRecipeTemplate::RefreshResultMetadata()
+{
+	ResultMetadata = FMounteaRecipeResultMetadata();
+
+	const UMounteaInventoryItemTemplate* resultItem = ResultItem.LoadSynchronous();
+	if (!IsValid(resultItem))
+		return;
+
+	ResultMetadata.ResultItemPath = ResultItem.ToSoftObjectPath();
+	ResultMetadata.DisplayName = resultItem->DisplayName;
+	ResultMetadata.ItemCategory = resultItem->ItemCategory;
+	ResultMetadata.ItemSubCategory = resultItem->ItemSubCategory;
+	ResultMetadata.ItemRarity = resultItem->ItemRarity;
+	ResultMetadata.Tags = resultItem->Tags;
+	ResultMetadata.ItemThumbnail = resultItem->ItemThumbnail;
+}
+
+void UMounteaRecipeTemplate::PreSave(FObjectPreSaveContext SaveContext)
+{
+	// Result item might have been edited since Recipe was last saved, refresh on every save and cook
+	RefreshResultMetadata();
+
+	Super::PreSave(SaveContext);
+}
+
+void UMounteaRecipeTemplate::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UMounteaRecipeTemplate, ResultItem))
+		RefreshResultMetadata();
+}
+
 void UMounteaRecipeTemplate::PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeChainProperty(PropertyChangedEvent);
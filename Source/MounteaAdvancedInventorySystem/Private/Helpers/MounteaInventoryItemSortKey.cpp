@@ -0,0 +1,131 @@
+﻿// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not 
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Helpers/MounteaInventoryItemSortKey.h"
+
+#include "Definitions/MounteaInventoryBaseDataTypes.h"
+#include "Definitions/MounteaInventoryItem.h"
+#include "Definitions/MounteaInventoryItemTemplate.h"
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
+
+namespace MounteaInventoryItemSort
+{
+	static FMounteaInventoryItemSortSpec::ESortKey GetSortKey(const FString& Key)
+	{
+		using ESortKey = FMounteaInventoryItemSortSpec::ESortKey;
+		
+		if (Key.Equals(TEXT("Name"), ESearchCase::IgnoreCase)) return ESortKey::Name;
+		if (Key.Equals(TEXT("Value"), ESearchCase::IgnoreCase)) return ESortKey::Value;
+		if (Key.Equals(TEXT("Weight"), ESearchCase::IgnoreCase)) return ESortKey::Weight;
+		if (Key.Equals(TEXT("Rarity"), ESearchCase::IgnoreCase)) return ESortKey::Rarity;
+		if (Key.Equals(TEXT("Category"), ESearchCase::IgnoreCase)) return ESortKey::Category;
+		if (Key.Equals(TEXT("Quantity"), ESearchCase::IgnoreCase)) return ESortKey::Quantity;
+		if (Key.Equals(TEXT("Durability"), ESearchCase::IgnoreCase)) return ESortKey::Durability;
+		return ESortKey::Unknown;
+	}
+
+	template<typename T>
+	static int32 CompareValues(const T A, const T B)
+	{
+		return A < B ? -1 : (B < A ? 1 : 0);
+	}
+}
+
+FMounteaInventoryItemSortSpec FMounteaInventoryItemSortSpec::Make(const TArray<FInventorySortCriteria>& SortingCriteria)
+{
+	TArray<FInventorySortCriteria> sortedCriteria = SortingCriteria;
+	sortedCriteria.StableSort([](const FInventorySortCriteria& A, const FInventorySortCriteria& B)
+	{
+		return A.SortPriority > B.SortPriority;
+	});
+
+	// Criteria used to be applied as consecutive stable passes, so the last applied (lowest priority) criteria is the primary key
+	FMounteaInventoryItemSortSpec returnValue;
+	for (int32 i = sortedCriteria.Num() - 1; i >= 0; --i)
+	{
+		const ESortKey sortKey = MounteaInventoryItemSort::GetSortKey(sortedCriteria[i].SortingKey);
+		if (sortKey == ESortKey::Unknown || returnValue.UsesKey(sortKey))
+			continue;
+
+		returnValue.UsedKeysMask |= 1 << static_cast<uint8>(sortKey);
+		returnValue.SortKeys.Add(sortKey);
+	}
+	
+	return returnValue;
+}
+
+FMounteaInventoryItemSortKey FMounteaInventoryItemSortKey::Make(const FMounteaInventoryItem& Item, const FMounteaInventoryItemSortSpec& SortSpec)
+{
+	using ESortKey = FMounteaInventoryItemSortSpec::ESortKey;
+	
+	FMounteaInventoryItemSortKey returnValue;
+	returnValue.Quantity = Item.GetQuantity();
+	returnValue.Durability = Item.GetDurability();
+
+	if (SortSpec.UsesKey(ESortKey::Name))
+		returnValue.Name = Item.GetItemName().ToString();
+
+	if (!Item.Template)
+		return returnValue;
+
+	returnValue.Value = Item.Template->BasePrice * Item.GetQuantity();
+	returnValue.Weight = Item.Template->Weight * Item.GetQuantity();
+
+	if ((SortSpec.UsesKey(ESortKey::Rarity) || SortSpec.UsesKey(ESortKey::Category)) && FMounteaAdvancedInventorySettingsCache::GetInventoryConfig())
+	{
+		const FInventoryRarity* itemRarity = FMounteaAdvancedInventorySettingsCache::FindRarity(Item.Template->ItemRarity);
+		returnValue.RarityPriority = itemRarity ? itemRarity->RarityPriority : FInventoryRarity().RarityPriority;
+		returnValue.CategoryOrdinal = FMounteaAdvancedInventorySettingsCache::GetCategoryOrdinal(Item.Template->ItemCategory);
+	}
+	
+	return returnValue;
+}
+
+int32 FMounteaInventoryItemSortKey::Compare(const FMounteaInventoryItemSortSpec& SortSpec, const FMounteaInventoryItemSortKey& A, const FMounteaInventoryItemSortKey& B)
+{
+	using ESortKey = FMounteaInventoryItemSortSpec::ESortKey;
+	
+	for (const ESortKey sortKey : SortSpec.SortKeys)
+	{
+		int32 compareResult = 0;
+		switch (sortKey)
+		{
+			case ESortKey::Name:
+				compareResult = A.Name.Compare(B.Name);
+				break;
+			case ESortKey::Value:
+				compareResult = MounteaInventoryItemSort::CompareValues(A.Value, B.Value);
+				break;
+			case ESortKey::Weight:
+				compareResult = MounteaInventoryItemSort::CompareValues(A.Weight, B.Weight);
+				break;
+			case ESortKey::Rarity:
+				compareResult = MounteaInventoryItemSort::CompareValues(A.RarityPriority, B.RarityPriority);
+				break;
+			case ESortKey::Category:
+				compareResult = MounteaInventoryItemSort::CompareValues(A.CategoryOrdinal, B.CategoryOrdinal);
+				break;
+			case ESortKey::Quantity:
+				compareResult = MounteaInventoryItemSort::CompareValues(A.Quantity, B.Quantity);
+				break;
+			case ESortKey::Durability:
+				compareResult = MounteaInventoryItemSort::CompareValues(A.Durability, B.Durability);
+				break;
+			default:
+				break;
+		}
+
+		if (compareResult != 0)
+			return compareResult;
+	}
+	
+	return 0;
+}
@@ -0,0 +1,236 @@
+﻿// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not 
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Helpers/MounteaInventoryItemsView.h"
+
+#include "Algo/StableSort.h"
+#include "Definitions/MounteaInventoryItemTemplate.h"
+#include "Logs/MounteaAdvancedInventoryLog.h"
+
+namespace MounteaInventoryItemsView
+{
+	/** Mirrors FindItems, any enabled criteria is enough for Item to match. */
+	static bool MatchesSearchParams(const FMounteaInventoryItem& Item, const FInventoryItemSearchParams& SearchParams)
+	{
+		if (!SearchParams.bSearchByGuid && !SearchParams.bSearchByTemplate && 
+			!SearchParams.bSearchByTags && !SearchParams.bSearchByCategory && 
+			!SearchParams.bSearchByRarity)
+		{
+			return true;
+		}
+
+		if (!Item.IsItemValid())
+			return false;
+
+		if (SearchParams.bSearchByGuid && Item.GetGuid() == SearchParams.ItemGuid)
+			return true;
+
+		if (SearchParams.bSearchByTemplate && Item.GetTemplate() == SearchParams.Template)
+			return true;
+
+		if (SearchParams.bSearchByTags)
+		{
+			if (SearchParams.bRequireAllTags ? Item.GetCustomData().HasAll(SearchParams.Tags) : Item.GetCustomData().HasAny(SearchParams.Tags))
+				return true;
+		}
+
+		if (SearchParams.bSearchByCategory && Item.GetTemplate()->ItemCategory == SearchParams.CategoryId)
+			return true;
+
+		if (SearchParams.bSearchByRarity && Item.GetTemplate()->ItemRarity == SearchParams.RarityId)
+			return true;
+
+		return false;
+	}
+}
+
+void UMounteaInventoryItemsView::BindInventory(const TScriptInterface<IMounteaAdvancedInventoryInterface>& InInventory)
+{
+	UnbindInventory();
+
+	Inventory = InInventory;
+
+	// Event handles are native only, Blueprint implemented inventories cannot be observed
+	if (IMounteaAdvancedInventoryInterface* inventoryInterface = Cast<IMounteaAdvancedInventoryInterface>(Inventory.GetObject()))
+	{
+		inventoryInterface->GetOnItemAddedEventHandle().AddUniqueDynamic(this, &UMounteaInventoryItemsView::ProcessItemAdded);
+		inventoryInterface->GetOnItemRemovedEventHandle().AddUniqueDynamic(this, &UMounteaInventoryItemsView::ProcessItemRemoved);
+		inventoryInterface->GetOnItemQuantityChangedEventHandle().AddUniqueDynamic(this, &UMounteaInventoryItemsView::ProcessItemQuantityChanged);
+		inventoryInterface->GetOnItemDurabilityChangedEventHandle().AddUniqueDynamic(this, &UMounteaInventoryItemsView::ProcessItemDurabilityChanged);
+	}
+	else if (IsValid(Inventory.GetObject()))
+		LOG_WARNING(TEXT("[MounteaInventoryItemsView] Inventory '%s' does not implement the interface natively, view will not observe its changes!"), *Inventory.GetObject()->GetName())
+
+	RebuildView();
+}
+
+void UMounteaInventoryItemsView::UnbindInventory()
+{
+	if (IMounteaAdvancedInventoryInterface* inventoryInterface = Cast<IMounteaAdvancedInventoryInterface>(Inventory.GetObject()))
+	{
+		inventoryInterface->GetOnItemAddedEventHandle().RemoveDynamic(this, &UMounteaInventoryItemsView::ProcessItemAdded);
+		inventoryInterface->GetOnItemRemovedEventHandle().RemoveDynamic(this, &UMounteaInventoryItemsView::ProcessItemRemoved);
+		inventoryInterface->GetOnItemQuantityChangedEventHandle().RemoveDynamic(this, &UMounteaInventoryItemsView::ProcessItemQuantityChanged);
+		inventoryInterface->GetOnItemDurabilityChangedEventHandle().RemoveDynamic(this, &UMounteaInventoryItemsView::ProcessItemDurabilityChanged);
+	}
+
+	Inventory = nullptr;
+	Items.Reset();
+	SortKeys.Reset();
+}
+
+void UMounteaInventoryItemsView::SetSearchParams(const FInventoryItemSearchParams& InSearchParams)
+{
+	SearchParams = InSearchParams;
+	RebuildView();
+}
+
+void UMounteaInventoryItemsView::SetSortingCriteria(const TArray<FInventorySortCriteria>& InSortingCriteria)
+{
+	SortingCriteria = InSortingCriteria;
+	SortSpec = FMounteaInventoryItemSortSpec::Make(SortingCriteria);
+	RebuildView();
+}
+
+void UMounteaInventoryItemsView::RebuildView()
+{
+	Items.Reset();
+	SortKeys.Reset();
+
+	if (Inventory.GetObject())
+	{
+		const TArray<FMounteaInventoryItem> foundItems = IMounteaAdvancedInventoryInterface::Execute_FindItems(Inventory.GetObject(), SearchParams);
+
+		TArray<TPair<int32, FMounteaInventoryItemSortKey>> sortRecords;
+		sortRecords.Reserve(foundItems.Num());
+		for (int32 i = 0; i < foundItems.Num(); ++i)
+			sortRecords.Emplace(i, FMounteaInventoryItemSortKey::Make(foundItems[i], SortSpec));
+
+		if (!SortSpec.IsEmpty())
+		{
+			Algo::StableSort(sortRecords, [this](const TPair<int32, FMounteaInventoryItemSortKey>& A, const TPair<int32, FMounteaInventoryItemSortKey>& B)
+			{
+				return FMounteaInventoryItemSortKey::Compare(SortSpec, A.Value, B.Value) < 0;
+			});
+		}
+
+		Items.Reserve(sortRecords.Num());
+		SortKeys.Reserve(sortRecords.Num());
+		for (TPair<int32, FMounteaInventoryItemSortKey>& sortRecord : sortRecords)
+		{
+			Items.Add(foundItems[sortRecord.Key]);
+			SortKeys.Add(MoveTemp(sortRecord.Value));
+		}
+	}
+
+	OnItemsViewRebuilt.Broadcast();
+}
+
+int32 UMounteaInventoryItemsView::GetItemIndex(const FGuid& ItemGuid) const
+{
+	return Items.IndexOfByPredicate([&ItemGuid](const FMounteaInventoryItem& Item)
+	{
+		return Item.GetGuid() == ItemGuid;
+	});
+}
+
+void UMounteaInventoryItemsView::BeginDestroy()
+{
+	UnbindInventory();
+	
+	Super::BeginDestroy();
+}
+
+void UMounteaInventoryItemsView::ProcessItemAdded(const FMounteaInventoryItem& AddedItem)
+{
+	UpdateItem(AddedItem);
+}
+
+void UMounteaInventoryItemsView::ProcessItemRemoved(const FMounteaInventoryItem& RemovedItem)
+{
+	const int32 itemIndex = GetItemIndex(RemovedItem.GetGuid());
+	if (itemIndex == INDEX_NONE)
+		return;
+
+	RemoveItemAt(itemIndex);
+	OnItemsViewUpdated.Broadcast(RemovedItem.GetGuid(), itemIndex, INDEX_NONE);
+}
+
+void UMounteaInventoryItemsView::ProcessItemQuantityChanged(const FMounteaInventoryItem& Item, int32 OldQuantity, int32 NewQuantity)
+{
+	UpdateItem(Item);
+}
+
+void UMounteaInventoryItemsView::ProcessItemDurabilityChanged(const FMounteaInventoryItem& Item, float OldDurability, float NewDurability)
+{
+	UpdateItem(Item);
+}
+
+void UMounteaInventoryItemsView::UpdateItem(const FMounteaInventoryItem& Item)
+{
+	const FGuid itemGuid = Item.GetGuid();
+	const int32 oldIndex = GetItemIndex(itemGuid);
+	
+	if (!MounteaInventoryItemsView::MatchesSearchParams(Item, SearchParams))
+	{
+		if (oldIndex != INDEX_NONE)
+		{
+			RemoveItemAt(oldIndex);
+			OnItemsViewUpdated.Broadcast(itemGuid, oldIndex, INDEX_NONE);
+		}
+		return;
+	}
+
+	FMounteaInventoryItemSortKey sortKey = FMounteaInventoryItemSortKey::Make(Item, SortSpec);
+
+	// Item which keeps its order relative to neighbours is updated in place
+	if (oldIndex != INDEX_NONE)
+	{
+		const bool bAfterPrevious = oldIndex == 0 || FMounteaInventoryItemSortKey::Compare(SortSpec, SortKeys[oldIndex - 1], sortKey) <= 0;
+		const bool bBeforeNext = oldIndex == SortKeys.Num() - 1 || FMounteaInventoryItemSortKey::Compare(SortSpec, sortKey, SortKeys[oldIndex + 1]) <= 0;
+		if (bAfterPrevious && bBeforeNext)
+		{
+			Items[oldIndex] = Item;
+			SortKeys[oldIndex] = MoveTemp(sortKey);
+			OnItemsViewUpdated.Broadcast(itemGuid, oldIndex, oldIndex);
+			return;
+		}
+
+		RemoveItemAt(oldIndex);
+	}
+
+	const int32 newIndex = FindInsertIndex(sortKey);
+	Items.Insert(Item, newIndex);
+	SortKeys.Insert(MoveTemp(sortKey), newIndex);
+	OnItemsViewUpdated.Broadcast(itemGuid, oldIndex, newIndex);
+}
+
+void UMounteaInventoryItemsView::RemoveItemAt(const int32 ItemIndex)
+{
+	Items.RemoveAt(ItemIndex);
+	SortKeys.RemoveAt(ItemIndex);
+}
+
+int32 UMounteaInventoryItemsView::FindInsertIndex(const FMounteaInventoryItemSortKey& SortKey) const
+{
+	// Upper bound, so new Item goes after Items with equal keys same as stable sort would place it
+	int32 lowIndex = 0;
+	int32 highIndex = SortKeys.Num();
+	while (lowIndex < highIndex)
+	{
+		const int32 middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+		if (FMounteaInventoryItemSortKey::Compare(SortSpec, SortKey, SortKeys[middleIndex]) < 0)
+			highIndex = middleIndex;
+		else
+			lowIndex = middleIndex + 1;
+	}
+	return lowIndex;
+}
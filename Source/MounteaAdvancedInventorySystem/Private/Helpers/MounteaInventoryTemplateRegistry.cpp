@@ -0,0 +1,202 @@
+﻿// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not 
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Helpers/MounteaInventoryTemplateRegistry.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Definitions/MounteaInventoryItemTemplate.h"
+#include "Engine/AssetManager.h"
+#include "Engine/NetConnection.h"
+#include "Engine/PackageMapClient.h"
+#include "Logs/MounteaAdvancedInventoryLog.h"
+
+namespace MounteaTemplateRegistry
+{
+	/** Unknown indices come from remote peers, so they are reported at most once per interval. */
+	constexpr double UnknownIndexLogInterval = 10.0;
+}
+
+int32 FMounteaInventoryTemplateRegistry::GetTemplateIndex(const UMounteaInventoryItemTemplate* Template)
+{
+	if (!IsValid(Template) || !Template->IsAsset())
+		return INDEX_NONE;
+
+	FMounteaInventoryTemplateRegistry& registry = Get();
+	registry.BuildIfNeeded();
+
+	const int32* templateIndex = registry.TemplateIndices.Find(FSoftObjectPath(Template));
+	return templateIndex ? *templateIndex : INDEX_NONE;
+}
+
+UMounteaInventoryItemTemplate* FMounteaInventoryTemplateRegistry::GetTemplateByIndex(const int32 Index, bool& bOutPending)
+{
+	bOutPending = false;
+
+	FMounteaInventoryTemplateRegistry& registry = Get();
+	registry.BuildIfNeeded();
+
+	if (!registry.TemplatePaths.IsValidIndex(Index))
+	{
+		registry.LogUnknownIndex(Index);
+		return nullptr;
+	}
+
+	const FSoftObjectPath& templatePath = registry.TemplatePaths[Index];
+	if (UMounteaInventoryItemTemplate* loadedTemplate = Cast<UMounteaInventoryItemTemplate>(templatePath.ResolveObject()))
+		return loadedTemplate;
+
+	// Packet is being received, loading synchronously here would hitch
+	if (!registry.PendingLoads.Contains(Index))
+	{
+		TSharedPtr<FStreamableHandle> loadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			templatePath,
+			FStreamableDelegate::CreateLambda([Index, templatePath]()
+			{
+				FMounteaInventoryTemplateRegistry& loadedRegistry = Get();
+				loadedRegistry.PendingLoads.Remove(Index);
+
+				UMounteaInventoryItemTemplate* loadedTemplate = Cast<UMounteaInventoryItemTemplate>(templatePath.ResolveObject());
+				if (!IsValid(loadedTemplate))
+				{
+					LOG_WARNING(TEXT("[Template Registry] Failed to load template %s!"), *templatePath.ToString())
+					return;
+				}
+
+				loadedRegistry.TemplateLoadedEvent.Broadcast(Index, loadedTemplate);
+			}));
+
+		if (loadHandle.IsValid() && loadHandle->IsLoadingInProgress())
+			registry.PendingLoads.Add(Index, loadHandle);
+	}
+
+	// Load might have completed right away
+	UMounteaInventoryItemTemplate* loadedTemplate = Cast<UMounteaInventoryItemTemplate>(templatePath.ResolveObject());
+	bOutPending = !IsValid(loadedTemplate) && registry.PendingLoads.Contains(Index);
+	return loadedTemplate;
+}
+
+FOnMounteaTemplateRegistryTemplateLoaded& FMounteaInventoryTemplateRegistry::OnTemplateLoaded()
+{
+	return Get().TemplateLoadedEvent;
+}
+
+uint32 FMounteaInventoryTemplateRegistry::GetChecksum()
+{
+	FMounteaInventoryTemplateRegistry& registry = Get();
+	registry.BuildIfNeeded();
+	return registry.Checksum;
+}
+
+void FMounteaInventoryTemplateRegistry::SetConnectionVerified(UNetConnection* Connection)
+{
+	if (!IsValid(Connection))
+		return;
+
+	FMounteaInventoryTemplateRegistry& registry = Get();
+	for (auto connectionIt = registry.VerifiedConnections.CreateIterator(); connectionIt; ++connectionIt)
+	{
+		if (!connectionIt->ResolveObjectPtr())
+			connectionIt.RemoveCurrent();
+	}
+
+	registry.VerifiedConnections.Add(TObjectKey<UNetConnection>(Connection));
+}
+
+bool FMounteaInventoryTemplateRegistry::CanUseIndices(UPackageMap* Map)
+{
+	// Local serialization has no remote end which could disagree
+	if (!Map)
+		return true;
+
+	UPackageMapClient* packageMapClient = Cast<UPackageMapClient>(Map);
+	UNetConnection* connection = packageMapClient ? packageMapClient->GetConnection() : nullptr;
+	return connection && Get().VerifiedConnections.Contains(TObjectKey<UNetConnection>(connection));
+}
+
+void FMounteaInventoryTemplateRegistry::Invalidate()
+{
+	FMounteaInventoryTemplateRegistry& registry = Get();
+	registry.TemplatePaths.Reset();
+	registry.TemplateIndices.Reset();
+	registry.VerifiedConnections.Reset();
+	registry.Checksum = 0;
+	registry.bIsBuilt = false;
+}
+
+FMounteaInventoryTemplateRegistry& FMounteaInventoryTemplateRegistry::Get()
+{
+	static FMounteaInventoryTemplateRegistry registry;
+	return registry;
+}
+
+void FMounteaInventoryTemplateRegistry::BuildIfNeeded()
+{
+	if (bIsBuilt)
+		return;
+
+	IAssetRegistry& assetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+#if WITH_EDITOR
+	if (!bIsBound)
+	{
+		// Templates created, deleted or renamed in editor change the indices
+		assetRegistry.OnAssetAdded().AddLambda([](const FAssetData&) { Invalidate(); });
+		assetRegistry.OnAssetRemoved().AddLambda([](const FAssetData&) { Invalidate(); });
+		assetRegistry.OnAssetRenamed().AddLambda([](const FAssetData&, const FString&) { Invalidate(); });
+		bIsBound = true;
+	}
+#endif
+
+	TArray<FAssetData> templateAssets;
+	assetRegistry.GetAssetsByClass(UMounteaInventoryItemTemplate::StaticClass()->GetClassPathName(), templateAssets, true);
+
+	// Sort keys are built once, comparing paths directly would allocate strings in every comparison
+	TArray<TPair<FString, FSoftObjectPath>> sortedPaths;
+	sortedPaths.Reserve(templateAssets.Num());
+	for (const FAssetData& templateAsset : templateAssets)
+	{
+		const FSoftObjectPath templatePath = templateAsset.GetSoftObjectPath();
+		sortedPaths.Emplace(templatePath.ToString(), templatePath);
+	}
+
+	// Sorting by path makes indices independent of registry discovery order
+	sortedPaths.Sort([](const TPair<FString, FSoftObjectPath>& A, const TPair<FString, FSoftObjectPath>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	TemplatePaths.Reset(sortedPaths.Num());
+	TemplateIndices.Reset();
+	TemplateIndices.Reserve(sortedPaths.Num());
+	Checksum = 0;
+	for (const TPair<FString, FSoftObjectPath>& sortedPath : sortedPaths)
+	{
+		TemplateIndices.Add(sortedPath.Value, TemplatePaths.Add(sortedPath.Value));
+		Checksum = FCrc::StrCrc32(*sortedPath.Key, Checksum);
+	}
+
+	// Registry which is still discovering assets would produce incomplete indices
+	bIsBuilt = !assetRegistry.IsLoadingAssets();
+}
+
+void FMounteaInventoryTemplateRegistry::LogUnknownIndex(const int32 Index)
+{
+	const double currentTime = FPlatformTime::Seconds();
+	if (currentTime - LastUnknownIndexLogTime < MounteaTemplateRegistry::UnknownIndexLogInterval)
+	{
+		++SuppressedUnknownIndexLogs;
+		return;
+	}
+
+	LOG_WARNING(TEXT("[Template Registry] Unknown template index %d! (%d similar warnings suppressed)"), Index, SuppressedUnknownIndexLogs)
+	LastUnknownIndexLogTime = currentTime;
+	SuppressedUnknownIndexLogs = 0;
+}
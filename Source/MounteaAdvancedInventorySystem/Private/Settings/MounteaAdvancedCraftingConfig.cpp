@@ -11,3 +11,17 @@
 
 
 #include "Settings/MounteaAdvancedCraftingConfig.h"
+
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
+
+#if WITH_EDITOR
+
+void UMounteaAdvancedCraftingConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UMounteaAdvancedCraftingConfig, AllowedRecipes))
+		FMounteaAdvancedInventorySettingsCache::Invalidate();
+}
+
+#endif
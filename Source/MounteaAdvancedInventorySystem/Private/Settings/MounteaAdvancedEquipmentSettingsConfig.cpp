@@ -14,6 +14,7 @@
 
 #include "Algo/AnyOf.h"
 #include "Algo/ForEach.h"
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
 
 UMounteaAdvancedEquipmentSettingsConfig::UMounteaAdvancedEquipmentSettingsConfig()
 {
@@ -40,6 +41,8 @@ void UMounteaAdvancedEquipmentSettingsConfig::PostEditChangeProperty(FPropertyCh
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	FMounteaAdvancedInventorySettingsCache::Invalidate();
+
 	if (PropertyChangedEvent.GetMemberPropertyName() !=
 		GET_MEMBER_NAME_CHECKED(UMounteaAdvancedEquipmentSettingsConfig, AllowedEquipmentSlots))
 	{
@@ -12,7 +12,7 @@
 
 #include "Settings/MounteaAdvancedInventorySettings.h"
 
-#include "Settings/MounteaAdvancedInventorySettingsConfig.h"
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
 
 UMounteaAdvancedInventorySettings::UMounteaAdvancedInventorySettings() : 
 	AdvancedInventorySettingsConfig(nullptr),
@@ -29,56 +29,12 @@ EMounteaAdvancedInventoryLoggingVerbosity UMounteaAdvancedInventorySettings::Get
 
 TMap<FString, FInventoryRarity> UMounteaAdvancedInventorySettings::GetAllowedRarities() const
 {
-	auto advancedInventorySettingsConfig = AdvancedInventorySettingsConfig.LoadSynchronous();
-	if (!IsValid(advancedInventorySettingsConfig))
-	{
-		TMap<FString, FInventoryRarity> returnValues;
-		FInventoryRarity CommonRarity;
-		CommonRarity.RarityDisplayName = NSLOCTEXT(
-			"UMounteaAdvancedInventorySettings", "CommonRarity", "Common");
-		CommonRarity.RarityColor = FLinearColor(0.5f, 0.5f, 0.5f);
-		CommonRarity.BasePriceMultiplier = 1.0f;
-		CommonRarity.RarityPriority = 0;
-		returnValues.Add(TEXT("Common"), CommonRarity);
-
-		return returnValues;
-	}
-
-	auto returnValues = advancedInventorySettingsConfig->AllowedRarities;
-
-	returnValues.ValueStableSort(
-		[](const FInventoryRarity& A, const FInventoryRarity& B)
-		{
-			return A.RarityPriority > B.RarityPriority;
-		});
-
-	return returnValues;
+	return FMounteaAdvancedInventorySettingsCache::GetSortedRarities();
 }
 
 TMap<FString, FInventoryCategory> UMounteaAdvancedInventorySettings::GetAllowedCategories() const
 {
-	auto advancedInventorySettingsConfig = AdvancedInventorySettingsConfig.LoadSynchronous();
-	if (!IsValid(advancedInventorySettingsConfig))
-	{
-		TMap<FString, FInventoryCategory> returnValues;
-		FInventoryCategory miscellaneousCategory;
-		miscellaneousCategory.CategoryData.CategoryDisplayName = NSLOCTEXT(
-			"UMounteaAdvancedInventorySettings", "miscellaneousCategory", "Miscellaneous");
-		miscellaneousCategory.CategoryData.CategoryPriority = -5;
-		returnValues.Add(TEXT("All"), miscellaneousCategory);
-
-		return returnValues;
-	}
-
-	auto returnValues = advancedInventorySettingsConfig->AllowedCategories;
-
-	returnValues.ValueStableSort(
-		[](const FInventoryCategory& A, const FInventoryCategory& B)
-		{
-			return A.CategoryData.CategoryPriority > B.CategoryData.CategoryPriority;
-		});
-
-	return returnValues;
+	return FMounteaAdvancedInventorySettingsCache::GetSortedCategories();
 }
 
 
@@ -86,3 +42,18 @@ TSoftObjectPtr<UInputMappingContext> UMounteaAdvancedInventorySettings::GetAdvan
 {
 	return AdvancedInventoryEquipmentInputMapping;
 }
+
+#if WITH_EDITOR
+
+void UMounteaAdvancedInventorySettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	const FName propertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (propertyName == GET_MEMBER_NAME_CHECKED(UMounteaAdvancedInventorySettings, AdvancedInventorySettingsConfig)
+		|| propertyName == GET_MEMBER_NAME_CHECKED(UMounteaAdvancedInventorySettings, AdvancedCraftingSettingsConfig)
+		|| propertyName == GET_MEMBER_NAME_CHECKED(UMounteaAdvancedInventorySettings, AdvancedEquipmentSettingsConfig))
+		FMounteaAdvancedInventorySettingsCache::Invalidate();
+}
+
+#endif
@@ -0,0 +1,319 @@
+﻿// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not 
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
+
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/AssetManager.h"
+#include "Definitions/MounteaRecipeTemplate.h"
+#include "Settings/MounteaAdvancedCraftingConfig.h"
+#include "Settings/MounteaAdvancedInventorySettings.h"
+#include "Settings/MounteaAdvancedInventorySettingsConfig.h"
+
+UMounteaAdvancedInventorySettingsConfig* FMounteaAdvancedInventorySettingsCache::GetInventoryConfig()
+{
+	FMounteaAdvancedInventorySettingsCache& settingsCache = Get();
+	settingsCache.BuildIfNeeded();
+	return settingsCache.InventoryConfig;
+}
+
+const TMap<FString, FInventoryCategory>& FMounteaAdvancedInventorySettingsCache::GetSortedCategories()
+{
+	FMounteaAdvancedInventorySettingsCache& settingsCache = Get();
+	settingsCache.BuildIfNeeded();
+	return settingsCache.SortedCategories;
+}
+
+const TMap<FString, FInventoryRarity>& FMounteaAdvancedInventorySettingsCache::GetSortedRarities()
+{
+	FMounteaAdvancedInventorySettingsCache& settingsCache = Get();
+	settingsCache.BuildIfNeeded();
+	return settingsCache.SortedRarities;
+}
+
+const FInventoryCategory* FMounteaAdvancedInventorySettingsCache::FindCategory(const FString& CategoryId)
+{
+	return GetSortedCategories().Find(CategoryId);
+}
+
+const FInventoryRarity* FMounteaAdvancedInventorySettingsCache::FindRarity(const FString& RarityId)
+{
+	return GetSortedRarities().Find(RarityId);
+}
+
+int32 FMounteaAdvancedInventorySettingsCache::GetRarityOrdinal(const FString& RarityId)
+{
+	FMounteaAdvancedInventorySettingsCache& settingsCache = Get();
+	settingsCache.BuildIfNeeded();
+	const int32* rarityOrdinal = settingsCache.RarityOrdinals.Find(RarityId);
+	return rarityOrdinal ? *rarityOrdinal : INDEX_NONE;
+}
+
+int32 FMounteaAdvancedInventorySettingsCache::GetCategoryOrdinal(const FString& CategoryId)
+{
+	FMounteaAdvancedInventorySettingsCache& settingsCache = Get();
+	settingsCache.BuildIfNeeded();
+	const int32* categoryOrdinal = settingsCache.CategoryOrdinals.Find(CategoryId);
+	return categoryOrdinal ? *categoryOrdinal : INDEX_NONE;
+}
+
+const TArray<FGameplayTag>& FMounteaAdvancedInventorySettingsCache::GetSortedCategoryTags()
+{
+	FMounteaAdvancedInventorySettingsCache& settingsCache = Get();
+	settingsCache.BuildIfNeeded();
+	return settingsCache.SortedCategoryTags;
+}
+
+bool FMounteaAdvancedInventorySettingsCache::IsAllowedCategoryTag(const FGameplayTag& CategoryTag)
+{
+	FMounteaAdvancedInventorySettingsCache& settingsCache = Get();
+	settingsCache.BuildIfNeeded();
+	return settingsCache.AllowedCategoryTags.Contains(CategoryTag);
+}
+
+const FInventoryNotificationConfig* FMounteaAdvancedInventorySettingsCache::FindNotificationConfig(const FString& NotificationType)
+{
+	const UMounteaAdvancedInventorySettingsConfig* inventoryConfig = GetInventoryConfig();
+	return inventoryConfig ? inventoryConfig->NotificationConfigs.Find(NotificationType) : nullptr;
+}
+
+UMounteaRecipeTemplate* FMounteaAdvancedInventorySettingsCache::FindRecipe(const FGuid& RecipeGuid)
+{
+	const TSoftObjectPtr<UMounteaRecipeTemplate>* recipe = GetAllowedRecipes().Find(RecipeGuid);
+	if (!recipe)
+		return nullptr;
+
+	// Recipe might have been garbage collected since the index was built
+	UMounteaRecipeTemplate* recipeTemplate = recipe->Get();
+	return recipeTemplate ? recipeTemplate : recipe->LoadSynchronous();
+}
+
+const TMap<FGuid, TSoftObjectPtr<UMounteaRecipeTemplate>>& FMounteaAdvancedInventorySettingsCache::GetAllowedRecipes()
+{
+	FMounteaAdvancedInventorySettingsCache& settingsCache = Get();
+	settingsCache.BuildRecipesIfNeeded();
+	return settingsCache.RecipesByGuid;
+}
+
+const TSet<UMounteaRecipeTemplate*>& FMounteaAdvancedInventorySettingsCache::GetAllowedRecipeTemplates()
+{
+	FMounteaAdvancedInventorySettingsCache& settingsCache = Get();
+	settingsCache.BuildRecipesIfNeeded();
+	if (!settingsCache.bRecipeTemplatesBuilt)
+	{
+		settingsCache.RecipeTemplates.Reset();
+		settingsCache.RecipeTemplates.Reserve(settingsCache.RecipesByGuid.Num());
+		for (const auto& allowedRecipe : settingsCache.RecipesByGuid)
+		{
+			if (UMounteaRecipeTemplate* recipeTemplate = FindRecipe(allowedRecipe.Key))
+				settingsCache.RecipeTemplates.Add(recipeTemplate);
+		}
+		settingsCache.bRecipeTemplatesBuilt = true;
+	}
+	return settingsCache.RecipeTemplates;
+}
+
+uint32 FMounteaAdvancedInventorySettingsCache::GetRevision()
+{
+	FMounteaAdvancedInventorySettingsCache& settingsCache = Get();
+	settingsCache.BuildIfNeeded();
+	return settingsCache.Revision;
+}
+
+FSimpleMulticastDelegate& FMounteaAdvancedInventorySettingsCache::OnRecipesChanged()
+{
+	return Get().RecipesChanged;
+}
+
+void FMounteaAdvancedInventorySettingsCache::Invalidate()
+{
+	FMounteaAdvancedInventorySettingsCache& settingsCache = Get();
+	settingsCache.bIsBuilt = false;
+	settingsCache.bRecipesBuilt = false;
+	settingsCache.bRecipeTemplatesBuilt = false;
+	settingsCache.RecipeTemplates.Reset();
+	if (settingsCache.UnindexedRecipesHandle.IsValid())
+	{
+		settingsCache.UnindexedRecipesHandle->CancelHandle();
+		settingsCache.UnindexedRecipesHandle.Reset();
+	}
+	settingsCache.Revision++;
+	settingsCache.RecipesChanged.Broadcast();
+}
+
+void FMounteaAdvancedInventorySettingsCache::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(InventoryConfig);
+	Collector.AddReferencedObjects(RecipeTemplates);
+}
+
+FString FMounteaAdvancedInventorySettingsCache::GetReferencerName() const
+{
+	return TEXT("FMounteaAdvancedInventorySettingsCache");
+}
+
+FMounteaAdvancedInventorySettingsCache& FMounteaAdvancedInventorySettingsCache::Get()
+{
+	static FMounteaAdvancedInventorySettingsCache settingsCache;
+	return settingsCache;
+}
+
+void FMounteaAdvancedInventorySettingsCache::BuildIfNeeded()
+{
+	// Config asset is kept referenced, cache is rebuilt only after invalidation
+	if (bIsBuilt)
+		return;
+
+	const UMounteaAdvancedInventorySettings* inventorySettings = GetDefault<UMounteaAdvancedInventorySettings>();
+	InventoryConfig = inventorySettings ? inventorySettings->AdvancedInventorySettingsConfig.LoadSynchronous() : nullptr;
+
+	SortedCategories.Reset();
+	SortedRarities.Reset();
+	
+	if (IsValid(InventoryConfig))
+	{
+		SortedCategories = InventoryConfig->AllowedCategories;
+		SortedRarities = InventoryConfig->AllowedRarities;
+	}
+	else
+	{
+		FInventoryCategory miscellaneousCategory;
+		miscellaneousCategory.CategoryData.CategoryDisplayName = NSLOCTEXT(
+			"UMounteaAdvancedInventorySettings", "miscellaneousCategory", "Miscellaneous");
+		miscellaneousCategory.CategoryData.CategoryPriority = -5;
+		SortedCategories.Add(TEXT("All"), miscellaneousCategory);
+		
+		FInventoryRarity commonRarity;
+		commonRarity.RarityDisplayName = NSLOCTEXT(
+			"UMounteaAdvancedInventorySettings", "CommonRarity", "Common");
+		commonRarity.RarityColor = FLinearColor(0.5f, 0.5f, 0.5f);
+		commonRarity.BasePriceMultiplier = 1.0f;
+		commonRarity.RarityPriority = 0;
+		SortedRarities.Add(TEXT("Common"), commonRarity);
+	}
+
+	SortedCategories.ValueStableSort(
+		[](const FInventoryCategory& A, const FInventoryCategory& B)
+		{
+			return A.CategoryData.CategoryPriority > B.CategoryData.CategoryPriority;
+		});
+	SortedRarities.ValueStableSort(
+		[](const FInventoryRarity& A, const FInventoryRarity& B)
+		{
+			return A.RarityPriority > B.RarityPriority;
+		});
+
+	CategoryOrdinals.Reset();
+	for (const auto& sortedCategory : SortedCategories)
+		CategoryOrdinals.Add(sortedCategory.Key, CategoryOrdinals.Num());
+	
+	RarityOrdinals.Reset();
+	for (const auto& sortedRarity : SortedRarities)
+		RarityOrdinals.Add(sortedRarity.Key, RarityOrdinals.Num());
+
+	FGameplayTagContainer categoryTags;
+	AllowedCategoryTags.Reset();
+	for (const auto& sortedCategory : SortedCategories)
+	{
+		categoryTags.AppendTags(sortedCategory.Value.CategoryData.CategoryTags);
+		AllowedCategoryTags.Append(sortedCategory.Value.CategoryData.CategoryTags.GetGameplayTagArray());
+		for (const auto& subCategory : sortedCategory.Value.SubCategories)
+			AllowedCategoryTags.Append(subCategory.Value.CategoryTags.GetGameplayTagArray());
+	}
+	AllowedCategoryTags.Remove(FGameplayTag::EmptyTag);
+
+	SortedCategoryTags.Reset();
+	categoryTags.GetGameplayTagArray(SortedCategoryTags);
+	SortedCategoryTags.RemoveAll([](const FGameplayTag& categoryTag)
+	{
+		return !categoryTag.IsValid();
+	});
+	SortedCategoryTags.Sort([](const FGameplayTag& Left, const FGameplayTag& Right)
+	{
+		return Left.ToString() < Right.ToString();
+	});
+
+	bIsBuilt = true;
+}
+
+void FMounteaAdvancedInventorySettingsCache::BuildRecipesIfNeeded()
+{
+	if (bRecipesBuilt)
+		return;
+
+	RecipesByGuid.Reset();
+
+	const UMounteaAdvancedInventorySettings* inventorySettings = GetDefault<UMounteaAdvancedInventorySettings>();
+	const UMounteaAdvancedCraftingConfig* craftingConfig = inventorySettings ? inventorySettings->AdvancedCraftingSettingsConfig.LoadSynchronous() : nullptr;
+	if (IsValid(craftingConfig))
+	{
+		const IAssetRegistry* assetRegistry = IAssetRegistry::Get();
+		TArray<TSoftObjectPtr<UMounteaRecipeTemplate>> unindexedRecipes;
+		TArray<FSoftObjectPath> unindexedPaths;
+
+		RecipesByGuid.Reserve(craftingConfig->AllowedRecipes.Num());
+		for (const TSoftObjectPtr<UMounteaRecipeTemplate>& allowedRecipe : craftingConfig->AllowedRecipes)
+		{
+			if (allowedRecipe.IsNull())
+				continue;
+
+			if (const UMounteaRecipeTemplate* recipeTemplate = allowedRecipe.Get())
+			{
+				RecipesByGuid.Add(recipeTemplate->RecipeGuid, allowedRecipe);
+				continue;
+			}
+
+			FString recipeGuidTag;
+			FGuid recipeGuid;
+			const FAssetData recipeData = assetRegistry ? assetRegistry->GetAssetByObjectPath(allowedRecipe.ToSoftObjectPath()) : FAssetData();
+			if (recipeData.IsValid() && recipeData.GetTagValue(GET_MEMBER_NAME_CHECKED(UMounteaRecipeTemplate, RecipeGuid), recipeGuidTag) && FGuid::Parse(recipeGuidTag, recipeGuid))
+			{
+				RecipesByGuid.Add(recipeGuid, allowedRecipe);
+				continue;
+			}
+
+			// Recipe was not re-saved since its Guid became a registry tag, index it once loaded
+			unindexedRecipes.Add(allowedRecipe);
+			unindexedPaths.Add(allowedRecipe.ToSoftObjectPath());
+		}
+
+		if (unindexedPaths.Num() > 0)
+		{
+			const uint32 requestRevision = Revision;
+			UnindexedRecipesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(unindexedPaths,
+				FStreamableDelegate::CreateLambda([unindexedRecipes, requestRevision]()
+				{
+					Get().OnUnindexedRecipesLoaded(unindexedRecipes, requestRevision);
+				}));
+		}
+	}
+
+	bRecipesBuilt = true;
+}
+
+void FMounteaAdvancedInventorySettingsCache::OnUnindexedRecipesLoaded(const TArray<TSoftObjectPtr<UMounteaRecipeTemplate>>& LoadedRecipes, const uint32 RequestRevision)
+{
+	UnindexedRecipesHandle.Reset();
+
+	// Settings were invalidated meanwhile, rebuild will request its own load
+	if (RequestRevision != Revision)
+		return;
+
+	for (const TSoftObjectPtr<UMounteaRecipeTemplate>& loadedRecipe : LoadedRecipes)
+	{
+		if (const UMounteaRecipeTemplate* recipeTemplate = loadedRecipe.Get())
+			RecipesByGuid.Add(recipeTemplate->RecipeGuid, loadedRecipe);
+	}
+
+	bRecipeTemplatesBuilt = false;
+	Revision++;
+	RecipesChanged.Broadcast();
+}
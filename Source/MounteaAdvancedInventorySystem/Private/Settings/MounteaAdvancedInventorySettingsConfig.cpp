@@ -14,6 +14,7 @@
 
 #include "Definitions/MounteaInventoryBaseCommands.h"
 #include "Logs/MounteaAdvancedInventoryLog.h"
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
 
 #define LOCTEXT_NAMESPACE "MounteaAdvancedInventorySettingsConfig"
 
@@ -330,7 +331,9 @@ void UMounteaAdvancedInventorySettingsConfig::PostEditChangeChainProperty(struct
 	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UMounteaAdvancedInventorySettingsConfig, AllowedInventoryTypes))
 	{
 		ValidateInventoryTypes();
-	}	
+	}
+
+	FMounteaAdvancedInventorySettingsCache::Invalidate();
 }
 
 void UMounteaAdvancedInventorySettingsConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
@@ -358,7 +361,9 @@ void UMounteaAdvancedInventorySettingsConfig::PostEditChangeProperty(FPropertyCh
 					subCategoryData.CategoryTags.AppendTags(categoryData.CategoryData.CategoryTags);
 			}
 		}
-	}	
+	}
+
+	FMounteaAdvancedInventorySettingsCache::Invalidate();
 }
 
 #endif
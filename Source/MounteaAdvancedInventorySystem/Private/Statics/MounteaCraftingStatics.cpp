@@ -13,10 +13,10 @@
 #include "Statics/MounteaCraftingStatics.h"
 
 #include "Algo/Copy.h"
-#include "Algo/ForEach.h"
 #include "Algo/Transform.h"
 #include "Definitions/MounteaCraftingBaseDataTypes.h"
 #include "Definitions/MounteaCraftingBaseEnums.h"
+#include "Definitions/MounteaInventoryBaseEnums.h"
 #include "Definitions/MounteaInventoryBaseDataTypes.h"
 #include "Definitions/MounteaInventoryItemTemplate.h"
 #include "Definitions/MounteaInventoryItemTemplate_Recipe.h"
@@ -28,7 +28,9 @@
 #include "Interfaces/Inventory/MounteaAdvancedInventoryInterface.h"
 #include "Settings/MounteaAdvancedCraftingConfig.h"
 #include "Settings/MounteaAdvancedInventorySettings.h"
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
 #include "Statics/MounteaInventoryStatics.h"
+#include "Statics/MounteaInventorySystemStatics.h"
 
 #define MOUNTEA_BIND_CRAFTING_DELEGATE(Target, Binding, HandleGetter) \
 	if (!IsValid(Target) || !(Binding).IsBound()) \
@@ -48,6 +50,60 @@
 	nativeInterface->HandleGetter().Remove(Binding); \
 	return true
 
+namespace MounteaCraftingHelpers
+{
+	/** Sums required quantity per ingredient template of single ingredient option. Fails if option contains invalid ingredient. */
+	static bool ReserveIngredients(const UMounteaRecipeIngredientsList* Ingredients, TMap<UMounteaInventoryItemTemplate*, int32>& OutReservedIngredients)
+	{
+		if (!IsValid(Ingredients))
+			return false;
+
+		OutReservedIngredients.Reserve(Ingredients->RecipeIngredients.Num());
+		for (const UMounteaRecipeIngredient* ingredient : Ingredients->RecipeIngredients)
+		{
+			UMounteaInventoryItemTemplate* ingredientTemplate = IsValid(ingredient) ? ingredient->IngredientSource.LoadSynchronous() : nullptr;
+			if (!IsValid(ingredientTemplate))
+				return false;
+
+			if (ingredient->RequiredQuantity > 0)
+				OutReservedIngredients.FindOrAdd(ingredientTemplate) += ingredient->RequiredQuantity;
+		}
+
+		return true;
+	}
+
+	/** @return How many times reserved ingredients are available, MAX_int32 if nothing is reserved. */
+	static int32 GetCraftableCount(const TMap<UMounteaInventoryItemTemplate*, int32>& ReservedIngredients, const TMap<UMounteaInventoryItemTemplate*, int32>& AvailableQuantities)
+	{
+		int32 craftableCount = MAX_int32;
+		for (const TPair<UMounteaInventoryItemTemplate*, int32>& reservedIngredient : ReservedIngredients)
+		{
+			const int32* availableQuantity = AvailableQuantities.Find(reservedIngredient.Key);
+			craftableCount = FMath::Min(craftableCount, availableQuantity ? *availableQuantity / reservedIngredient.Value : 0);
+		}
+
+		return craftableCount;
+	}
+
+	/** Resolves category of Recipe's result item. Result item is loaded only if Recipe has no valid metadata. */
+	static bool GetResultItemCategory(const UMounteaRecipeTemplate* Recipe, FString& OutItemCategory)
+	{
+		if (Recipe->HasValidResultMetadata())
+		{
+			OutItemCategory = Recipe->ResultMetadata.ItemCategory;
+			return true;
+		}
+
+		// Recipe was not re-saved since metadata was introduced
+		const UMounteaInventoryItemTemplate* resultItem = Recipe->ResultItem.LoadSynchronous();
+		if (!IsValid(resultItem))
+			return false;
+
+		OutItemCategory = resultItem->ItemCategory;
+		return true;
+	}
+}
+
 bool UMounteaCraftingStatics::HasInventoryItemForRecipeSourceCached(
 	const TScriptInterface<IMounteaAdvancedInventoryInterface>& Inventory,
 	UMounteaInventoryItemTemplate_Recipe* RecipeSource,
@@ -192,6 +248,98 @@ TArray<UMounteaRecipeTemplate*> UMounteaCraftingStatics::ApplyIngredientAvailabi
 	return result;
 }
 
+TArray<UMounteaRecipeTemplate*> UMounteaCraftingStatics::ApplyIngredientAvailabilityFilter(
+	UObject* Target,
+	const TScriptInterface<IMounteaAdvancedInventoryInterface>& Inventory,
+	const TArray<UMounteaRecipeTemplate*>& SourceRecipes)
+{
+	// Blueprint-only participants have no craftability cache, fall back to searching the Inventory
+	if (!Cast<IMounteaAdvancedCraftingParticipantInterface>(Target))
+		return ApplyIngredientAvailabilityFilter(Inventory, SourceRecipes);
+
+	TArray<UMounteaRecipeTemplate*> result;
+	result.Reserve(SourceRecipes.Num());
+	Algo::CopyIf(SourceRecipes, result,
+		[Target](UMounteaRecipeTemplate* recipe) -> bool
+		{
+			return IsValid(recipe) && IMounteaAdvancedCraftingParticipantInterface::Execute_GetRecipeCraftability(Target, recipe).IsCraftable();
+		});
+
+	return result;
+}
+
+FMounteaRecipeCraftability UMounteaCraftingStatics::CalculateRecipeCraftability(
+	UMounteaRecipeTemplate* Recipe,
+	const TMap<TObjectPtr<UMounteaInventoryItemTemplate>, int32>& IngredientQuantities)
+{
+	FMounteaRecipeCraftability result;
+	result.Recipe = Recipe;
+	
+	if (!IsValid(Recipe))
+		return result;
+
+	if (Recipe->RecipeIngredientOptions.Num() == 0)
+	{
+		result.CraftableCount = MAX_int32;
+		return result;
+	}
+
+	int32 bestMissingQuantity = MAX_int32;
+	for (UMounteaRecipeIngredientsList* ingredientGroup : Recipe->RecipeIngredientOptions)
+	{
+		// invalid ingredient groups are treated as non-craftable options and skipped.
+		if (!IsValid(ingredientGroup))
+			continue;
+
+		bool bIsGroupValid = true;
+		int32 groupCraftableCount = MAX_int32;
+		int32 groupMissingQuantity = 0;
+		TMap<TObjectPtr<UMounteaInventoryItemTemplate>, int32> groupMissingIngredients;
+		
+		for (const UMounteaRecipeIngredient* ingredient : ingredientGroup->RecipeIngredients)
+		{
+			if (!IsValid(ingredient) || ingredient->IngredientSource.IsNull())
+			{
+				bIsGroupValid = false;
+				break;
+			}
+
+			if (ingredient->RequiredQuantity <= 0)
+				continue;
+
+			// Ingredient which is not loaded cannot be held by any Inventory, so nothing of it is available
+			UMounteaInventoryItemTemplate* ingredientTemplate = ingredient->IngredientSource.Get();
+			const int32* availableQuantityPtr = ingredientTemplate ? IngredientQuantities.Find(ingredientTemplate) : nullptr;
+			const int32 availableQuantity = availableQuantityPtr ? *availableQuantityPtr : 0;
+			
+			groupCraftableCount = FMath::Min(groupCraftableCount, availableQuantity / ingredient->RequiredQuantity);
+			if (availableQuantity < ingredient->RequiredQuantity)
+			{
+				const int32 missingQuantity = ingredient->RequiredQuantity - availableQuantity;
+				if (ingredientTemplate)
+					groupMissingIngredients.FindOrAdd(ingredientTemplate) += missingQuantity;
+				groupMissingQuantity += missingQuantity;
+			}
+		}
+
+		if (!bIsGroupValid)
+			continue;
+
+		const bool bIsBetterGroup = result.IngredientsList == nullptr
+			|| groupCraftableCount > result.CraftableCount
+			|| (groupCraftableCount == 0 && result.CraftableCount == 0 && groupMissingQuantity < bestMissingQuantity);
+		if (!bIsBetterGroup)
+			continue;
+
+		result.CraftableCount = groupCraftableCount;
+		result.IngredientsList = ingredientGroup;
+		result.MissingIngredients = MoveTemp(groupMissingIngredients);
+		bestMissingQuantity = groupMissingQuantity;
+	}
+
+	return result;
+}
+
 bool UMounteaCraftingStatics::IsRecipeInCategory(
 	const UMounteaRecipeTemplate* Recipe,
 	const FGameplayTag& CategoryTag)
@@ -199,16 +347,11 @@ bool UMounteaCraftingStatics::IsRecipeInCategory(
 	if (!IsValid(Recipe) || !CategoryTag.IsValid())
 		return false;
 
-	const UMounteaInventoryItemTemplate* resultItem = Recipe->ResultItem.LoadSynchronous();
-	if (!IsValid(resultItem))
+	FString itemCategory;
+	if (!MounteaCraftingHelpers::GetResultItemCategory(Recipe, itemCategory))
 		return false;
 
-	const UMounteaAdvancedInventorySettings* inventorySettings = GetDefault<UMounteaAdvancedInventorySettings>();
-	if (!IsValid(inventorySettings))
-		return false;
-
-	const TMap<FString, FInventoryCategory>& allowedCategories = inventorySettings->GetAllowedCategories();
-	const FInventoryCategory* allowedCategory = allowedCategories.Find(resultItem->ItemCategory);
+	const FInventoryCategory* allowedCategory = FMounteaAdvancedInventorySettingsCache::FindCategory(itemCategory);
 	if (!allowedCategory)
 		return false;
 
@@ -235,41 +378,12 @@ TArray<UMounteaRecipeTemplate*> UMounteaCraftingStatics::ApplyCategoryFilter(
 
 void UMounteaCraftingStatics::GetAllowedInventoryCategoryTags(TArray<FGameplayTag>& OutCategoryTags)
 {
-	OutCategoryTags.Empty();
-
-	const UMounteaAdvancedInventorySettings* inventorySettings = GetDefault<UMounteaAdvancedInventorySettings>();
-	if (!IsValid(inventorySettings))
-		return;
-
-	const TMap<FString, FInventoryCategory>& allowedCategories = inventorySettings->GetAllowedCategories();
-	FGameplayTagContainer allowedCategoryTags;
-	Algo::ForEach(allowedCategories,
-		[&allowedCategoryTags](const TPair<FString, FInventoryCategory>& allowedCategory)
-		{
-			allowedCategoryTags.AppendTags(allowedCategory.Value.CategoryData.CategoryTags);
-		});
-
-	allowedCategoryTags.GetGameplayTagArray(OutCategoryTags);
-	OutCategoryTags.RemoveAll([](const FGameplayTag& categoryTag)
-	{
-		return !categoryTag.IsValid();
-	});
-
-	OutCategoryTags.Sort([](const FGameplayTag& Left, const FGameplayTag& Right)
-	{
-		return Left.ToString() < Right.ToString();
-	});
+	OutCategoryTags = FMounteaAdvancedInventorySettingsCache::GetSortedCategoryTags();
 }
 
 bool UMounteaCraftingStatics::IsAllowedInventoryCategoryTag(const FGameplayTag& CategoryTag)
 {
-	if (!CategoryTag.IsValid())
-		return false;
-
-	TArray<FGameplayTag> allowedCategoryTags;
-	GetAllowedInventoryCategoryTags(allowedCategoryTags);
-
-	return allowedCategoryTags.Contains(CategoryTag);
+	return CategoryTag.IsValid() && FMounteaAdvancedInventorySettingsCache::IsAllowedCategoryTag(CategoryTag);
 }
 
 TArray<UMounteaRecipeTemplate*> UMounteaCraftingStatics::ApplyStationTypeFilter(
@@ -368,7 +482,7 @@ TArray<UMounteaRecipeTemplate*> UMounteaCraftingStatics::GetFilteredRecipes(UObj
 	// 3) station type
 	// 4) recipe source
 	if (SearchFilter.bSearchByAvailableIngredients)
-		filteredRecipes = ApplyIngredientAvailabilityFilter(parentInventory, filteredRecipes);
+		filteredRecipes = ApplyIngredientAvailabilityFilter(Target, parentInventory, filteredRecipes);
 
 	if (SearchFilter.bSearchByCategory)
 	{
@@ -415,11 +529,7 @@ TArray<FInventoryCategory> UMounteaCraftingStatics::GetAllowedCategoriesWithCraf
 	if (!IsValidRecipeHandler(Target))
 		return {};
 
-	const UMounteaAdvancedInventorySettings* settings = GetDefault<UMounteaAdvancedInventorySettings>();
-	if (!IsValid(settings))
-		return {};
-
-	const TMap<FString, FInventoryCategory> allowedCategories = settings->GetAllowedCategories();
+	const TMap<FString, FInventoryCategory>& allowedCategories = FMounteaAdvancedInventorySettingsCache::GetSortedCategories();
 	if (allowedCategories.Num() == 0)
 		return {};
 
@@ -438,11 +548,10 @@ TArray<FInventoryCategory> UMounteaCraftingStatics::GetAllowedCategoriesWithCraf
 		if (!IsValid(recipe))
 			continue;
 
-		const UMounteaInventoryItemTemplate* resultItem = recipe->ResultItem.LoadSynchronous();
-		if (!IsValid(resultItem))
+		FString itemCategory;
+		if (!MounteaCraftingHelpers::GetResultItemCategory(recipe, itemCategory))
 			continue;
 
-		const FString& itemCategory = resultItem->ItemCategory;
 		if (craftableCategoryIds.Contains(itemCategory))
 			continue;
 
@@ -510,11 +619,21 @@ bool UMounteaCraftingStatics::IsCraftingPossible(UObject* Target, UMounteaRecipe
 	return IsValidRecipeHandler(Target) ? IMounteaAdvancedCraftingParticipantInterface::Execute_IsCraftingPossible(Target, TemplateToCraft) : false;
 }
 
+FMounteaRecipeCraftability UMounteaCraftingStatics::GetRecipeCraftability(UObject* Target, UMounteaRecipeTemplate* RecipeTemplate)
+{
+	return IsValidRecipeHandler(Target) ? IMounteaAdvancedCraftingParticipantInterface::Execute_GetRecipeCraftability(Target, RecipeTemplate) : FMounteaRecipeCraftability();
+}
+
 FMounteaCraftingResult UMounteaCraftingStatics::StartCrafting(UObject* Target, UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients)
 {
 	return IMounteaAdvancedCraftingParticipantInterface::Execute_StartCrafting(Target, TemplateToCraft, Ingredients);
 }
 
+FMounteaCraftingResult UMounteaCraftingStatics::StartCraftingMultiple(UObject* Target, UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients, const int32 CraftCount)
+{
+	return IsValidRecipeHandler(Target) ? IMounteaAdvancedCraftingParticipantInterface::Execute_StartCraftingMultiple(Target, TemplateToCraft, Ingredients, CraftCount) : FMounteaCraftingResult();
+}
+
 TScriptInterface<IMounteaAdvancedInventoryInterface> UMounteaCraftingStatics::GetParentInventory(UObject* Target)
 {
 	return IsValidRecipeHandler(Target) ? IMounteaAdvancedCraftingParticipantInterface::Execute_GetParentInventory(Target) : TScriptInterface<IMounteaAdvancedInventoryInterface>();
@@ -542,30 +661,24 @@ TScriptInterface<IMounteaAdvancedCraftingStationInterface> UMounteaCraftingStati
 
 TSet<UMounteaRecipeTemplate*> UMounteaCraftingStatics::GetAllRecipeTemplates()
 {
-	const auto settings = GetDefault<UMounteaAdvancedInventorySettings>();
-	if (!IsValid(settings))
-		return TSet<UMounteaRecipeTemplate*>();
-	const auto craftingConfig = settings->AdvancedCraftingSettingsConfig.LoadSynchronous();
-	if (!IsValid(craftingConfig))
-		return TSet<UMounteaRecipeTemplate*>();
-	const auto& allowedRecipes = craftingConfig->AllowedRecipes;
-
-	TSet<UMounteaRecipeTemplate*> returnValue;
-	returnValue.Reserve(allowedRecipes.Num());
-
-	for(const auto& recipe : allowedRecipes)
-	{
-		returnValue.Add(recipe.Get());
-	}
+	return GetAllRecipeTemplatesRef();
+}
 
-	return returnValue;
+const TSet<UMounteaRecipeTemplate*>& UMounteaCraftingStatics::GetAllRecipeTemplatesRef()
+{
+	return FMounteaAdvancedInventorySettingsCache::GetAllowedRecipeTemplates();
 }
 
 FMounteaCraftingResult UMounteaCraftingStatics::CraftItem(const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Target, const UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients)
+{
+	return CraftItems(Target, TemplateToCraft, Ingredients, 1);
+}
+
+FMounteaCraftingResult UMounteaCraftingStatics::CraftItems(const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Target, const UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients, const int32 CraftCount)
 {
 	FMounteaCraftingResult result;
 
-	if (!Target || !IsValid(TemplateToCraft) || !IsValid(Ingredients))
+	if (!Target || !IsValid(TemplateToCraft) || CraftCount <= 0 || TemplateToCraft->QuantityPerCreation <= 0)
 		return result;
 	
 	const auto craftingStation = Target->Execute_GetCraftingStation(Target.GetObject());
@@ -584,40 +697,75 @@ FMounteaCraftingResult UMounteaCraftingStatics::CraftItem(const TScriptInterface
 	if (!IsValid(resultTemplate))
 		return result;
 
-	for (const UMounteaRecipeIngredient* ingredient : Ingredients->RecipeIngredients)
+	// Single pass over Inventory for ingredient availability and the stack result is added to
+	TMap<UMounteaInventoryItemTemplate*, int32> inventoryQuantities;
+	int32 resultStackQuantity = INDEX_NONE;
+	const TArray<FMounteaInventoryItem> inventoryItems = IMounteaAdvancedInventoryInterface::Execute_GetAllItems(inventory.GetObject());
+	for (const FMounteaInventoryItem& inventoryItem : inventoryItems)
+	{
+		inventoryQuantities.FindOrAdd(inventoryItem.Template) += inventoryItem.GetQuantity();
+		if (resultStackQuantity == INDEX_NONE && inventoryItem.Template == resultTemplate)
+			resultStackQuantity = inventoryItem.GetQuantity();
+	}
+
+	// Ingredients sharing a template are reserved together, so the option is validated as a whole
+	TMap<UMounteaInventoryItemTemplate*, int32> reservedIngredients;
+	int32 craftableCount = 0;
+	if (IsValid(Ingredients))
 	{
-		if (!IsValid(ingredient))
+		// Requested option might come from a client, only options of this recipe are accepted
+		if (!TemplateToCraft->RecipeIngredientOptions.Contains(Ingredients))
 			return result;
 
-		UMounteaInventoryItemTemplate* ingredientTemplate = ingredient->IngredientSource.LoadSynchronous();
-		if (!IsValid(ingredientTemplate))
+		if (!MounteaCraftingHelpers::ReserveIngredients(Ingredients, reservedIngredients))
 			return result;
 
-		const TArray<FMounteaInventoryItem> foundItems =
-			IMounteaAdvancedInventoryInterface::Execute_FindItems(inventory.GetObject(), FInventoryItemSearchParams(ingredientTemplate));
+		craftableCount = MounteaCraftingHelpers::GetCraftableCount(reservedIngredients, inventoryQuantities);
+	}
+	else
+	{
+		// No option requested, use the one allowing most crafts
+		for (const UMounteaRecipeIngredientsList* ingredientOption : TemplateToCraft->RecipeIngredientOptions)
+		{
+			TMap<UMounteaInventoryItemTemplate*, int32> optionIngredients;
+			if (!MounteaCraftingHelpers::ReserveIngredients(ingredientOption, optionIngredients))
+				continue;
 
-		int32 totalQuantity = 0;
-		for (const FMounteaInventoryItem& item : foundItems)
-			totalQuantity += item.Quantity;
+			const int32 optionCraftableCount = MounteaCraftingHelpers::GetCraftableCount(optionIngredients, inventoryQuantities);
+			if (optionCraftableCount > craftableCount)
+			{
+				craftableCount = optionCraftableCount;
+				reservedIngredients = MoveTemp(optionIngredients);
+			}
+		}
+	}
 
-		if (totalQuantity < ingredient->RequiredQuantity)
-			return result;
+	// Result is added as a single stack, never craft more than it can hold
+	int32 resultCapacity = resultTemplate->MaxQuantity;
+	if (resultStackQuantity != INDEX_NONE)
+	{
+		resultCapacity = UMounteaInventorySystemStatics::HasFlag(resultTemplate->ItemFlags, EInventoryItemFlags::EIIF_Unique)
+			? 0 : resultTemplate->MaxQuantity - resultStackQuantity;
 	}
 
-	if (!IMounteaAdvancedInventoryInterface::Execute_CanAddItemFromTemplate(inventory.GetObject(), resultTemplate, TemplateToCraft->QuantityPerCreation))
+	// Recipe without ingredients is limited by result capacity only
+	const int32 craftedCount = FMath::Min3(CraftCount, craftableCount, resultCapacity / TemplateToCraft->QuantityPerCreation);
+	if (craftedCount <= 0)
 		return result;
 
-	for (const UMounteaRecipeIngredient* ingredient : Ingredients->RecipeIngredients)
-	{
-		UMounteaInventoryItemTemplate* ingredientTemplate = ingredient->IngredientSource.LoadSynchronous();
-		if (!IMounteaAdvancedInventoryInterface::Execute_RemoveItemFromTemplate(inventory.GetObject(), ingredientTemplate, ingredient->RequiredQuantity))
-			return result;
-	}
+	TArray<FInventoryTransactionOperation> craftingOperations;
+	craftingOperations.Reserve(reservedIngredients.Num() + 1);
+	for (const TPair<UMounteaInventoryItemTemplate*, int32>& reservedIngredient : reservedIngredients)
+		craftingOperations.Add(FInventoryTransactionOperation::MakeRemove(reservedIngredient.Key, reservedIngredient.Value * craftedCount));
+
+	craftingOperations.Add(FInventoryTransactionOperation::MakeAdd(FMounteaInventoryItem(resultTemplate, TemplateToCraft->QuantityPerCreation * craftedCount, 1, nullptr)));
 
-	if (!IMounteaAdvancedInventoryInterface::Execute_AddItemFromTemplate(inventory.GetObject(), resultTemplate, TemplateToCraft->QuantityPerCreation, 1))
+	// Ingredients are consumed and result is added atomically, failure (missing ingredients, full inventory) leaves inventory untouched
+	if (!IMounteaAdvancedInventoryInterface::Execute_ExecuteTransaction(inventory.GetObject(), craftingOperations))
 		return result;
 
 	result.bCraftingSuccess = true;
+	result.CraftedCount = craftedCount;
 	return result;
 }
 
@@ -670,6 +818,26 @@ bool UMounteaCraftingStatics::StopUsing(UObject* Target, const TScriptInterface<
 	return IsValidCraftingPlace(Target) ? IMounteaAdvancedCraftingStationInterface::Execute_StopUsing(Target, Participant) : false;
 }
 
+FGuid UMounteaCraftingStatics::EnqueueCraftingJob(UObject* Target, const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant, UMounteaRecipeTemplate* Recipe, UMounteaRecipeIngredientsList* Ingredients, const int32 Quantity)
+{
+	return IsValidCraftingPlace(Target) ? IMounteaAdvancedCraftingStationInterface::Execute_EnqueueCraftingJob(Target, Participant, Recipe, Ingredients, Quantity) : FGuid();
+}
+
+bool UMounteaCraftingStatics::CancelCraftingJob(UObject* Target, const FGuid& JobGuid)
+{
+	return IsValidCraftingPlace(Target) ? IMounteaAdvancedCraftingStationInterface::Execute_CancelCraftingJob(Target, JobGuid) : false;
+}
+
+TArray<FMounteaCraftingJob> UMounteaCraftingStatics::GetCraftingJobs(UObject* Target)
+{
+	return IsValidCraftingPlace(Target) ? IMounteaAdvancedCraftingStationInterface::Execute_GetCraftingJobs(Target) : TArray<FMounteaCraftingJob>();
+}
+
+float UMounteaCraftingStatics::GetCraftingJobProgress(UObject* Target, const FGuid& JobGuid)
+{
+	return IsValidCraftingPlace(Target) ? IMounteaAdvancedCraftingStationInterface::Execute_GetCraftingJobProgress(Target, JobGuid) : 0.f;
+}
+
 TArray<UMounteaRecipeTemplate*> UMounteaCraftingStatics::GetRecipesByCategory(UObject* Target, const FGameplayTag& CategoryTag)
 {
 	return GetFilteredRecipesByCategory(Target, CategoryTag);
@@ -13,7 +13,6 @@
 #include "Statics/MounteaEquipmentStatics.h"
 
 #include "Algo/Count.h"
-#include "Algo/Find.h"
 #include "Algo/Sort.h"
 #include "Algo/Transform.h"
 #include "Components/ActorComponent.h"
@@ -24,6 +23,7 @@
 #include "Definitions/MounteaEquipmentBaseEnums.h"
 #include "Definitions/MounteaInventoryItem.h"
 #include "Definitions/MounteaInventoryItemTemplate.h"
+#include "Engine/AssetManager.h"
 #include "Engine/SkeletalMesh.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/BlueprintGeneratedClass.h"
@@ -37,7 +37,9 @@
 #include "Logs/MounteaAdvancedInventoryLog.h"
 #include "Settings/MounteaAdvancedEquipmentSettingsConfig.h"
 #include "Settings/MounteaAdvancedInventorySettings.h"
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
 #include "Statics/MounteaAttachmentsStatics.h"
+#include "Subsystems/MounteaEquipmentActorPoolSubsystem.h"
 
 #define MOUNTEA_BIND_EQUIPMENT_ITEM_DELEGATE(Target, Binding, HandleGetter) \
 	if (!IsValid(Target) || !(Binding).IsBound()) \
@@ -57,6 +59,160 @@
 	nativeInterface->HandleGetter().Remove(Binding); \
 	return true
 
+namespace MounteaEquipmentSlotResolution
+{
+	struct FSlotResolutionKey
+	{
+		TArray<FGameplayTag> DesiredTags;
+		FGameplayTag EquipmentItemType;
+
+		bool operator==(const FSlotResolutionKey& Other) const
+		{
+			return EquipmentItemType == Other.EquipmentItemType && DesiredTags == Other.DesiredTags;
+		}
+
+		friend uint32 GetTypeHash(const FSlotResolutionKey& Key)
+		{
+			uint32 keyHash = GetTypeHash(Key.EquipmentItemType);
+			for (const FGameplayTag& desiredTag : Key.DesiredTags)
+				keyHash = HashCombine(keyHash, GetTypeHash(desiredTag));
+			return keyHash;
+		}
+	};
+
+	/** Ranked slots per item tags. Depends only on equipment config, so it is dropped whenever settings revision changes. */
+	struct FSlotResolutionCache
+	{
+		TMap<FSlotResolutionKey, TArray<FName>> RankedSlotIds;
+		TWeakObjectPtr<const UMounteaAdvancedEquipmentSettingsConfig> SettingsConfig;
+		uint32 SettingsRevision = 0;
+	};
+
+	static TArray<FName> RankSlotIds(const UMounteaAdvancedEquipmentSettingsConfig* settingsConfig,
+		const FGameplayTagContainer& DesiredTags, const FGameplayTag& EquipmentItemType)
+	{
+		TArray<FName> rankedSlotIds;
+
+		struct FSlotCandidate
+		{
+			FName SlotName = NAME_None;
+			bool bHasAllDesiredTags = false;
+			int32 OverlapCount = 0;
+			int32 ExtraTags = 0;
+		};
+
+		TArray<FGameplayTag> desiredTags;
+		DesiredTags.GetGameplayTagArray(desiredTags);
+
+		const auto isSlotCompatible = [&desiredTags, &settingsConfig, &EquipmentItemType](const FName& slotName)
+		{
+			const FMounteaEquipmentSlotHeaderData* slotData = settingsConfig->AllowedEquipmentSlots.Find(slotName);
+			if (!slotData)
+				return false;
+
+			if (!slotData->bIsEnabled)
+				return false;
+
+			if (EquipmentItemType.IsValid() &&
+				!slotData->AllowedItemTypes.IsEmpty() &&
+				!slotData->AllowedItemTypes.HasTag(EquipmentItemType))
+			{
+				return false;
+			}
+
+			const int32 overlapCount = Algo::CountIf(desiredTags, [slotData](const FGameplayTag& desiredTag)
+			{
+				return slotData->TagContainer.HasTag(desiredTag);
+			});
+
+			return overlapCount > 0;
+		};
+
+		TArray<FName> slotNames;
+		settingsConfig->AllowedEquipmentSlots.GetKeys(slotNames);
+
+		TArray<FSlotCandidate> candidates;
+		candidates.Reserve(slotNames.Num());
+
+		Algo::TransformIf(
+			slotNames,
+			candidates,
+			isSlotCompatible,
+			[&desiredTags, &settingsConfig, &DesiredTags](const FName& slotName)
+			{
+				const FMounteaEquipmentSlotHeaderData* slotData = settingsConfig->AllowedEquipmentSlots.Find(slotName);
+				check(slotData);
+
+				const int32 overlapCount = Algo::CountIf(desiredTags, [slotData](const FGameplayTag& desiredTag)
+				{
+					return slotData->TagContainer.HasTag(desiredTag);
+				});
+
+				FSlotCandidate candidate;
+				candidate.SlotName = slotName;
+				candidate.bHasAllDesiredTags = slotData->TagContainer.HasAll(DesiredTags);
+				candidate.OverlapCount = overlapCount;
+				candidate.ExtraTags = slotData->TagContainer.Num() - overlapCount;
+				return candidate;
+			});
+
+		if (candidates.IsEmpty())
+			return rankedSlotIds;
+
+		Algo::Sort(candidates, [](const FSlotCandidate& left, const FSlotCandidate& right)
+		{
+			if (left.bHasAllDesiredTags != right.bHasAllDesiredTags)
+				return left.bHasAllDesiredTags;
+
+			if (left.OverlapCount != right.OverlapCount)
+				return left.OverlapCount > right.OverlapCount;
+
+			if (left.ExtraTags != right.ExtraTags)
+				return left.ExtraTags < right.ExtraTags;
+
+			return left.SlotName.LexicalLess(right.SlotName);
+		});
+
+		rankedSlotIds.Reserve(candidates.Num());
+		for (const FSlotCandidate& candidate : candidates)
+			rankedSlotIds.Add(candidate.SlotName);
+
+		return rankedSlotIds;
+	}
+
+	static const TArray<FName>& FindRankedSlotIds(const FGameplayTagContainer& DesiredTags, const FGameplayTag& EquipmentItemType)
+	{
+		static const TArray<FName> emptySlotIds;
+		static FSlotResolutionCache slotResolutionCache;
+
+		const UMounteaAdvancedEquipmentSettingsConfig* settingsConfig = UMounteaEquipmentStatics::GetEquipmentSettingsConfig();
+		if (!IsValid(settingsConfig) || DesiredTags.IsEmpty() || settingsConfig->AllowedEquipmentSlots.IsEmpty())
+			return emptySlotIds;
+
+		const uint32 settingsRevision = FMounteaAdvancedInventorySettingsCache::GetRevision();
+		if (slotResolutionCache.SettingsConfig != settingsConfig || slotResolutionCache.SettingsRevision != settingsRevision)
+		{
+			slotResolutionCache.RankedSlotIds.Reset();
+			slotResolutionCache.SettingsConfig = settingsConfig;
+			slotResolutionCache.SettingsRevision = settingsRevision;
+		}
+
+		// Tag order does not affect ranking, keep single entry per tag set
+		FSlotResolutionKey resolutionKey;
+		DesiredTags.GetGameplayTagArray(resolutionKey.DesiredTags);
+		resolutionKey.DesiredTags.Sort([](const FGameplayTag& Left, const FGameplayTag& Right)
+		{
+			return Left.GetTagName().FastLess(Right.GetTagName());
+		});
+		resolutionKey.EquipmentItemType = EquipmentItemType;
+
+		if (const TArray<FName>* rankedSlotIds = slotResolutionCache.RankedSlotIds.Find(resolutionKey))
+			return *rankedSlotIds;
+
+		return slotResolutionCache.RankedSlotIds.Add(MoveTemp(resolutionKey), RankSlotIds(settingsConfig, DesiredTags, EquipmentItemType));
+	}
+}
+
 const FMounteaEquipmentSlotHeaderData* UMounteaEquipmentStatics::ResolveSlotHeaderData(
 	const UMounteaAdvancedAttachmentSlotBase* Slot,
 	const UMounteaAdvancedEquipmentSettingsConfig* SettingsConfig)
@@ -406,95 +562,14 @@ FName UMounteaEquipmentStatics::ResolveActiveSlotId(const FName& StorageSlotId)
 FName UMounteaEquipmentStatics::ResolveBestSlotIdFromTags(const FGameplayTagContainer& DesiredTags,
 	const FGameplayTag& EquipmentItemType)
 {
-	const UMounteaAdvancedEquipmentSettingsConfig* settingsConfig = GetEquipmentSettingsConfig();
-	if (!IsValid(settingsConfig))
-		return NAME_None;
-	if (DesiredTags.IsEmpty())
-		return NAME_None;
-	if (settingsConfig->AllowedEquipmentSlots.IsEmpty())
-		return NAME_None;
-
-	struct FSlotCandidate
-	{
-		FName SlotName = NAME_None;
-		bool bHasAllDesiredTags = false;
-		int32 OverlapCount = 0;
-		int32 ExtraTags = 0;
-	};
-
-	TArray<FGameplayTag> desiredTags;
-	DesiredTags.GetGameplayTagArray(desiredTags);
-
-	const auto isSlotCompatible = [&desiredTags, &settingsConfig, &EquipmentItemType](const FName& slotName)
-	{
-		const FMounteaEquipmentSlotHeaderData* slotData = settingsConfig->AllowedEquipmentSlots.Find(slotName);
-		if (!slotData)
-			return false;
-
-		if (!slotData->bIsEnabled)
-			return false;
-
-		if (EquipmentItemType.IsValid() &&
-			!slotData->AllowedItemTypes.IsEmpty() &&
-			!slotData->AllowedItemTypes.HasTag(EquipmentItemType))
-		{
-			return false;
-		}
-
-		const int32 overlapCount = Algo::CountIf(desiredTags, [slotData](const FGameplayTag& desiredTag)
-		{
-			return slotData->TagContainer.HasTag(desiredTag);
-		});
-
-		return overlapCount > 0;
-	};
-
-	TArray<FName> slotNames;
-	settingsConfig->AllowedEquipmentSlots.GetKeys(slotNames);
-
-	TArray<FSlotCandidate> candidates;
-	candidates.Reserve(slotNames.Num());
-
-	Algo::TransformIf(
-		slotNames,
-		candidates,
-		isSlotCompatible,
-		[&desiredTags, &settingsConfig, &DesiredTags](const FName& slotName)
-		{
-			const FMounteaEquipmentSlotHeaderData* slotData = settingsConfig->AllowedEquipmentSlots.Find(slotName);
-			check(slotData);
-
-			const int32 overlapCount = Algo::CountIf(desiredTags, [slotData](const FGameplayTag& desiredTag)
-			{
-				return slotData->TagContainer.HasTag(desiredTag);
-			});
-
-			FSlotCandidate candidate;
-			candidate.SlotName = slotName;
-			candidate.bHasAllDesiredTags = slotData->TagContainer.HasAll(DesiredTags);
-			candidate.OverlapCount = overlapCount;
-			candidate.ExtraTags = slotData->TagContainer.Num() - overlapCount;
-			return candidate;
-		});
-
-	if (candidates.IsEmpty())
-		return NAME_None;
-
-	Algo::Sort(candidates, [](const FSlotCandidate& left, const FSlotCandidate& right)
-	{
-		if (left.bHasAllDesiredTags != right.bHasAllDesiredTags)
-			return left.bHasAllDesiredTags;
-
-		if (left.OverlapCount != right.OverlapCount)
-			return left.OverlapCount > right.OverlapCount;
-
-		if (left.ExtraTags != right.ExtraTags)
-			return left.ExtraTags < right.ExtraTags;
-
-		return left.SlotName.LexicalLess(right.SlotName);
-	});
+	const TArray<FName>& rankedSlotIds = MounteaEquipmentSlotResolution::FindRankedSlotIds(DesiredTags, EquipmentItemType);
+	return rankedSlotIds.Num() > 0 ? rankedSlotIds[0] : NAME_None;
+}
 
-	return candidates[0].SlotName;
+TArray<FName> UMounteaEquipmentStatics::GetRankedSlotIdsFromTags(const FGameplayTagContainer& DesiredTags,
+	const FGameplayTag& EquipmentItemType)
+{
+	return MounteaEquipmentSlotResolution::FindRankedSlotIds(DesiredTags, EquipmentItemType);
 }
 
 UMounteaAdvancedAttachmentSlot* UMounteaEquipmentStatics::FindSlotWithEquippedItem(UObject* Outer, const FGuid& ItemGuid)
@@ -515,6 +590,12 @@ bool UMounteaEquipmentStatics::FindEquippedItemSlotAndInterface(UObject* Outer,
 	if (!Outer->Implements<UMounteaAdvancedAttachmentContainerInterface>())
 		return false;
 
+	if (const UMounteaEquipmentComponent* equipmentComponent = Cast<UMounteaEquipmentComponent>(Outer))
+	{
+		OutSlot = equipmentComponent->FindSlotByEquippedItemGuid(ItemGuid, OutInterface);
+		return IsValid(OutSlot);
+	}
+
 	const TArray<UMounteaAdvancedAttachmentSlot*> slots = IMounteaAdvancedAttachmentContainerInterface::Execute_GetAttachmentSlots(Outer);
 	for (UMounteaAdvancedAttachmentSlot* slot : slots)
 	{
@@ -568,40 +649,55 @@ bool UMounteaEquipmentStatics::TryResolveInventoryItemByGuid(UObject* Outer, con
 	if (!IsValid(Outer) || !ItemGuid.IsValid())
 		return false;
 
-	const auto tryResolveFromInventory = [&](const UObject* Candidate) -> bool
+	const UMounteaEquipmentComponent* equipmentComponent = Cast<UMounteaEquipmentComponent>(Outer);
+	const TArray<UObject*> inventories = IsValid(equipmentComponent)
+		? equipmentComponent->GetOwningInventories()
+		: ResolveInventoryObjects(Outer);
+
+	for (const UObject* inventory : inventories)
 	{
-		if (!IsValid(Candidate) || !Candidate->Implements<UMounteaAdvancedInventoryInterface>())
-			return false;
+		if (!IsValid(inventory))
+			continue;
 
 		const FMounteaInventoryItem foundItem = IMounteaAdvancedInventoryInterface::Execute_FindItem(
-			Candidate,
+			inventory,
 			FInventoryItemSearchParams(ItemGuid));
 		if (!foundItem.IsItemValid())
-			return false;
+			continue;
 
 		OutItemDefinition = foundItem;
 		return true;
+	}
+
+	return false;
+}
+
+TArray<UObject*> UMounteaEquipmentStatics::ResolveInventoryObjects(UObject* Outer)
+{
+	TArray<UObject*> inventories;
+	if (!IsValid(Outer))
+		return inventories;
+
+	const auto addInventory = [&inventories](UObject* Candidate)
+	{
+		if (IsValid(Candidate) && Candidate->Implements<UMounteaAdvancedInventoryInterface>())
+			inventories.AddUnique(Candidate);
 	};
 
-	if (tryResolveFromInventory(Outer))
-		return true;
+	addInventory(Outer);
 
 	AActor* owningActor = ResolveOwningActor(Outer);
-	if (tryResolveFromInventory(owningActor))
-		return true;
+	addInventory(owningActor);
 
 	if (!IsValid(owningActor))
-		return false;
+		return inventories;
 
 	const TArray<UActorComponent*> inventoryComponents = owningActor->GetComponentsByInterface(
 		UMounteaAdvancedInventoryInterface::StaticClass());
 	for (UActorComponent* inventoryComponent : inventoryComponents)
-	{
-		if (tryResolveFromInventory(inventoryComponent))
-			return true;
-	}
+		addInventory(inventoryComponent);
 
-	return false;
+	return inventories;
 }
 
 AActor* UMounteaEquipmentStatics::SpawnQuickUsePlaceholderActor(UObject* Outer, const FMounteaInventoryItem& ItemDefinition,
@@ -629,7 +725,7 @@ AActor* UMounteaEquipmentStatics::SpawnQuickUsePlaceholderActor(UObject* Outer,
 	spawnParams.Owner = ResolveOwningActor(Outer);
 	spawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-	AActor* placeholderActor = world->SpawnActor<AActor>(quickUseActorClass, FTransform::Identity, spawnParams);
+	AActor* placeholderActor = AcquireEquipmentActor(world, quickUseActorClass, spawnParams);
 	if (!IsValid(placeholderActor))
 		return nullptr;
 
@@ -688,6 +784,64 @@ bool UMounteaEquipmentStatics::IsSlotBlockedByCurrentAttachments(const UObject*
 	return false;
 }
 
+TBitArray<> UMounteaEquipmentStatics::GetSlotsBlockedByCurrentAttachments(const UObject* Outer, const bool bIgnoreSlotOccupant)
+{
+	if (!IsValid(Outer) || !Outer->Implements<UMounteaAdvancedAttachmentContainerInterface>())
+		return TBitArray<>();
+
+	const TArray<UMounteaAdvancedAttachmentSlot*> slots =
+		IMounteaAdvancedAttachmentContainerInterface::Execute_GetAttachmentSlots(Outer);
+	TBitArray<> blockedSlots(false, slots.Num());
+
+	const UMounteaAdvancedEquipmentSettingsConfig* settingsConfig = GetEquipmentSettingsConfig();
+	if (!IsValid(settingsConfig))
+		return blockedSlots;
+
+	// Attachment tags are resolved once per occupied slot instead of once per evaluated slot
+	TArray<TPair<int32, FGameplayTagContainer>> activeAttachmentTags;
+	FGameplayTagContainer allActiveAttachmentTags;
+	for (int32 slotIndex = 0; slotIndex < slots.Num(); ++slotIndex)
+	{
+		const UMounteaAdvancedAttachmentSlot* slot = slots[slotIndex];
+		if (!IsValid(slot) || !slot->IsOccupied() || !IsValid(slot->Attachment))
+			continue;
+
+		if (!IsAttachmentActiveEquipmentItem(slot->Attachment))
+			continue;
+
+		FGameplayTagContainer attachmentTags;
+		if (!TryGetAttachmentTags(slot->Attachment, attachmentTags))
+			continue;
+
+		allActiveAttachmentTags.AppendTags(attachmentTags);
+		activeAttachmentTags.Emplace(slotIndex, MoveTemp(attachmentTags));
+	}
+
+	if (activeAttachmentTags.Num() == 0)
+		return blockedSlots;
+
+	for (int32 slotIndex = 0; slotIndex < slots.Num(); ++slotIndex)
+	{
+		const FMounteaEquipmentSlotHeaderData* slotHeaderData = ResolveSlotHeaderData(slots[slotIndex], settingsConfig);
+		if (!slotHeaderData || !slotHeaderData->BlockedByTags.HasAny(allActiveAttachmentTags))
+			continue;
+
+		for (const TPair<int32, FGameplayTagContainer>& activeAttachment : activeAttachmentTags)
+		{
+			if (bIgnoreSlotOccupant && activeAttachment.Key == slotIndex)
+				continue;
+
+			if (slotHeaderData->BlockedByTags.HasAny(activeAttachment.Value))
+			{
+				blockedSlots[slotIndex] = true;
+				break;
+			}
+		}
+	}
+
+	return blockedSlots;
+}
+
 bool UMounteaEquipmentStatics::ClearBlockedSlotsForAttachment(UObject* Outer, UObject* BlockingAttachment,
 	const FGuid& BlockingItemGuid, const TSet<FName>& IgnoredSlots)
 {
@@ -748,7 +902,7 @@ bool UMounteaEquipmentStatics::ClearBlockedSlotsForAttachment(UObject* Outer, UO
 			return false;
 
 		if (IsValid(previousAttachmentActor))
-			previousAttachmentActor->Destroy();
+			ReleaseEquipmentActor(previousAttachmentActor);
 	}
 
 	return true;
@@ -779,7 +933,7 @@ bool UMounteaEquipmentStatics::SwitchEquippedItemSlot(UObject* Outer, UMounteaAd
 			return false;
 
 		if (IsValid(occupantActor))
-			occupantActor->Destroy();
+			ReleaseEquipmentActor(occupantActor);
 	}
 
 	UObject* attachmentObject = CurrentSlot->Attachment;
@@ -814,11 +968,46 @@ bool UMounteaEquipmentStatics::EnsureSlotIsReadyForEquip(UObject* Outer, const U
 		return false;
 
 	if (IsValid(occupantActor))
-		occupantActor->Destroy();
+		ReleaseEquipmentActor(occupantActor);
 
 	return true;
 }
 
+AActor* UMounteaEquipmentStatics::AcquireEquipmentActor(const UObject* Outer, UClass* ActorClass,
+	const FActorSpawnParameters& SpawnParams)
+{
+	if (!IsValid(Outer) || !IsValid(ActorClass))
+		return nullptr;
+
+	if (UMounteaEquipmentActorPoolSubsystem* actorPool = UMounteaEquipmentActorPoolSubsystem::Get(Outer))
+		return actorPool->AcquireActor(ActorClass, SpawnParams);
+
+	UWorld* world = Outer->GetWorld();
+	return IsValid(world) ? world->SpawnActor<AActor>(ActorClass, FTransform::Identity, SpawnParams) : nullptr;
+}
+
+void UMounteaEquipmentStatics::ReleaseEquipmentActor(AActor* Actor)
+{
+	if (!IsValid(Actor))
+		return;
+
+	UMounteaEquipmentActorPoolSubsystem* actorPool = UMounteaEquipmentActorPoolSubsystem::Get(Actor);
+	if (!actorPool)
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	const TScriptInterface<IMounteaAdvancedEquipmentItemInterface> equipmentItemInterface = FindEquipmentItemInterface(Actor);
+	if (equipmentItemInterface.GetObject())
+	{
+		IMounteaAdvancedEquipmentItemInterface::Execute_SetEquipmentItemState(equipmentItemInterface.GetObject(), EEquipmentItemState::EES_Idle);
+		IMounteaAdvancedEquipmentItemInterface::Execute_SetEquippedItemId(equipmentItemInterface.GetObject(), FGuid());
+	}
+
+	actorPool->ReleaseActor(Actor);
+}
+
 AActor* UMounteaEquipmentStatics::ResolveAttachmentActor(UObject* AttachmentObject)
 {
 	if (AActor* attachmentActor = Cast<AActor>(AttachmentObject))
@@ -872,7 +1061,8 @@ bool UMounteaEquipmentStatics::ValidateEquipmentItemRequest(const UObject* Outer
 	if (!IsValid(itemTemplate))
 		return false;
 
-	UClass* spawnClass = itemTemplate->SpawnActor.LoadSynchronous();
+	// Class is streamed in by DeferUntilSpawnActorLoaded, never loaded synchronously here
+	UClass* spawnClass = itemTemplate->SpawnActor.Get();
 	if (!IsTargetClassValid(spawnClass))
 		return false;
 
@@ -943,13 +1133,16 @@ bool UMounteaEquipmentStatics::CreateEquipmentItemAndAttach(UObject* Outer, cons
 	if (!IsValid(world))
 		return false;
 	
-	UClass* classToSpawn = itemTemplate->SpawnActor.LoadSynchronous();
+	if (DeferUntilSpawnActorLoaded(Outer, ItemDefinition, TargetSlot->SlotName))
+		return false;
+
+	UClass* classToSpawn = itemTemplate->SpawnActor.Get();
 	if (!IsValid(classToSpawn))
 		return false;
 	
 	FActorSpawnParameters spawnParams;
 	spawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	OutSpawnedActor = world->SpawnActor<AActor>(classToSpawn, FTransform(), spawnParams);
+	OutSpawnedActor = AcquireEquipmentActor(world, classToSpawn, spawnParams);
 	if (!IsValid(OutSpawnedActor))
 		return false;
 
@@ -968,7 +1161,7 @@ bool UMounteaEquipmentStatics::CreateEquipmentItemAndAttach(UObject* Outer, cons
 	if (!IMounteaAdvancedAttachmentContainerInterface::Execute_TryAttach(Outer, TargetSlot->SlotName, OutSpawnedActor))
 	{
 		if (IsValid(OutSpawnedActor))
-			OutSpawnedActor->Destroy();
+			ReleaseEquipmentActor(OutSpawnedActor);
 		OutSpawnedActor = nullptr;
 		return false;
 	}
@@ -987,10 +1180,47 @@ bool UMounteaEquipmentStatics::CreateEquipmentItemAndAttach(UObject* Outer, cons
 	return true;
 }
 
+bool UMounteaEquipmentStatics::DeferUntilSpawnActorLoaded(UObject* Outer, const FMounteaInventoryItem& ItemDefinition, const FName& TargetSlotId)
+{
+	const UMounteaInventoryItemTemplate* itemTemplate = ItemDefinition.GetTemplate();
+	if (!IsValid(Outer) || !IsValid(itemTemplate) || itemTemplate->SpawnActor.IsNull() || itemTemplate->SpawnActor.Get())
+		return false;
+
+	// Equipment component keeps the request, so it reports as pending and is cancelled with the component
+	if (UMounteaEquipmentComponent* equipmentComponent = Cast<UMounteaEquipmentComponent>(Outer))
+		return equipmentComponent->RequestEquipmentLoad(ItemDefinition, TargetSlotId);
+
+	const TWeakObjectPtr<UObject> weakOuter = Outer;
+	const TSharedPtr<FStreamableHandle> loadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		itemTemplate->SpawnActor.ToSoftObjectPath(),
+		FStreamableDelegate::CreateLambda([weakOuter, ItemDefinition, TargetSlotId]()
+		{
+			UObject* outer = weakOuter.Get();
+			if (!IsValid(outer))
+				return;
+
+			AActor* spawnedActor = nullptr;
+			if (TargetSlotId.IsNone())
+			{
+				EquipItemGeneral(outer, ItemDefinition, spawnedActor);
+				return;
+			}
+
+			UMounteaAdvancedAttachmentSlot* targetSlot = IMounteaAdvancedAttachmentContainerInterface::Execute_GetSlot(outer, TargetSlotId);
+			if (IsValid(targetSlot))
+				EquipItemToSlot(outer, ItemDefinition, targetSlot, spawnedActor);
+		}));
+
+	return loadHandle.IsValid();
+}
+
 bool UMounteaEquipmentStatics::EquipItemGeneral(UObject* Outer, const FMounteaInventoryItem& ItemDefinition, AActor*& OutSpawnedActor)
 {
 	OutSpawnedActor = nullptr;
 
+	if (DeferUntilSpawnActorLoaded(Outer, ItemDefinition, NAME_None))
+		return false;
+
 	UMounteaAdvancedAttachmentSlot* preferredSlot = nullptr;
 	if (!ValidateEquipmentItemRequest(Outer, ItemDefinition, preferredSlot))
 		return false;
@@ -1001,6 +1231,11 @@ bool UMounteaEquipmentStatics::EquipItemGeneral(UObject* Outer, const FMounteaIn
 bool UMounteaEquipmentStatics::EquipItemToSlot(UObject* Outer, const FMounteaInventoryItem& ItemDefinition, UMounteaAdvancedAttachmentSlot* TargetSlot,
 	AActor*& OutSpawnedActor)
 {
+	OutSpawnedActor = nullptr;
+
+	if (DeferUntilSpawnActorLoaded(Outer, ItemDefinition, IsValid(TargetSlot) ? TargetSlot->SlotName : NAME_None))
+		return false;
+
 	if (!ValidateEquipmentItemRequest(Outer, ItemDefinition, TargetSlot))
 		return false;
 
@@ -1079,18 +1314,20 @@ bool UMounteaEquipmentStatics::ValidateItemEquipped(const UMounteaEquipmentCompo
 		return hasMatchingEquippedGuid(foundSlot);
 	}
 
-	const TArray<UMounteaAdvancedAttachmentSlot*> attachmentSlots = IMounteaAdvancedAttachmentContainerInterface::Execute_GetAttachmentSlots(EquipmentComponent);
-	if (attachmentSlots.IsEmpty())
-		return false;
-
-	return Algo::FindByPredicate(attachmentSlots, hasMatchingEquippedGuid) != nullptr;
+	TScriptInterface<IMounteaAdvancedEquipmentItemInterface> equipmentItemInterface;
+	return IsValid(EquipmentComponent->FindSlotByEquippedItemGuid(expectedItemGuid, equipmentItemInterface));
 }
 
 bool UMounteaEquipmentStatics::EquipItem(const TScriptInterface<IMounteaAdvancedEquipmentInterface>& Target, const FMounteaInventoryItem& ItemDefinition)
 {
 	if (!Target.GetObject())
 		return false;
-	return IMounteaAdvancedEquipmentInterface::Execute_EquipItem(Target.GetObject(), ItemDefinition) != nullptr;
+	if (IMounteaAdvancedEquipmentInterface::Execute_EquipItem(Target.GetObject(), ItemDefinition) != nullptr)
+		return true;
+
+	// Equip completes once SpawnActor class loads
+	const UMounteaEquipmentComponent* equipmentComponent = Cast<UMounteaEquipmentComponent>(Target.GetObject());
+	return IsValid(equipmentComponent) && equipmentComponent->IsEquipmentLoadPending(ItemDefinition.GetGuid());
 }
 
 bool UMounteaEquipmentStatics::EquipItemToSlot(const TScriptInterface<IMounteaAdvancedEquipmentInterface>& Target,
@@ -1098,7 +1335,12 @@ bool UMounteaEquipmentStatics::EquipItemToSlot(const TScriptInterface<IMounteaAd
 {
 	if (!Target.GetObject())
 		return false;
-	return IMounteaAdvancedEquipmentInterface::Execute_EquipItemToSlot(Target.GetObject(), SlotName, ItemDefinition) != nullptr;
+	if (IMounteaAdvancedEquipmentInterface::Execute_EquipItemToSlot(Target.GetObject(), SlotName, ItemDefinition) != nullptr)
+		return true;
+
+	// Equip completes once SpawnActor class loads
+	const UMounteaEquipmentComponent* equipmentComponent = Cast<UMounteaEquipmentComponent>(Target.GetObject());
+	return IsValid(equipmentComponent) && equipmentComponent->IsEquipmentLoadPending(ItemDefinition.GetGuid());
 }
 
 bool UMounteaEquipmentStatics::IsItemEquipped(const TScriptInterface<IMounteaAdvancedEquipmentInterface>& Target,
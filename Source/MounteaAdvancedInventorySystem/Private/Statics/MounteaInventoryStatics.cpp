@@ -19,7 +19,10 @@
 #include "Definitions/MounteaInventoryBaseUIEnums.h"
 #include "Definitions/MounteaInventoryItemTemplate.h"
 #include "Definitions/MounteaEquipmentBaseDataTypes.h"
+#include "Helpers/MounteaInventoryItemSortKey.h"
+#include "Helpers/MounteaInventoryItemsView.h"
 #include "Settings/MounteaAdvancedInventorySettings.h"
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
 #include "Settings/MounteaAdvancedInventorySettingsConfig.h"
 #include "Settings/TemplatesConfig/MounteaAdvancedInventoryPayloadsConfig.h"
 #include "Statics/MounteaInventorySystemStatics.h"
@@ -156,9 +159,7 @@ UMounteaAdvancedInventorySettings* UMounteaInventoryStatics::GetInventorySetting
 
 UMounteaAdvancedInventorySettingsConfig* UMounteaInventoryStatics::GetInventorySettingsConfig()
 {
-	const auto settings = GetDefault<UMounteaAdvancedInventorySettings>();
-	if (!settings) return nullptr;
-	return settings->AdvancedInventorySettingsConfig.LoadSynchronous();
+	return FMounteaAdvancedInventorySettingsCache::GetInventoryConfig();
 }
 
 UPrimaryDataAsset* UMounteaInventoryStatics::GetTemplateConfig(const FString& Key)
@@ -252,6 +253,17 @@ TArray<FMounteaInventoryItem> UMounteaInventoryStatics::FindItems(const TScriptI
 	return Target.GetObject() ? Target->Execute_FindItems(Target.GetObject(), SearchParams) : TArray<FMounteaInventoryItem>();
 }
 
+UMounteaInventoryItemsView* UMounteaInventoryStatics::CreateInventoryItemsView(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target, const FInventoryItemSearchParams& SearchParams, const TArray<FInventorySortCriteria>& SortingCriteria)
+{
+	if (!Target.GetObject()) return nullptr;
+	
+	UMounteaInventoryItemsView* newView = NewObject<UMounteaInventoryItemsView>(Target.GetObject());
+	newView->SetSearchParams(SearchParams);
+	newView->SetSortingCriteria(SortingCriteria);
+	newView->BindInventory(Target);
+	return newView;
+}
+
 TArray<FMounteaInventoryItem> UMounteaInventoryStatics::GetAllItems(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target)
 {
 	return Target.GetObject() ? Target->Execute_GetAllItems(Target.GetObject()) : TArray<FMounteaInventoryItem>();
@@ -269,6 +281,12 @@ bool UMounteaInventoryStatics::HasItem(const TScriptInterface<IMounteaAdvancedIn
 	return IsValid(Target.GetObject()) ? Target->Execute_HasItem(Target.GetObject(), SearchParams) : false;
 }
 
+bool UMounteaInventoryStatics::ExecuteTransaction(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target,
+	const TArray<FInventoryTransactionOperation>& Operations)
+{
+	return Target.GetObject() ? Target->Execute_ExecuteTransaction(Target.GetObject(), Operations) : false;
+}
+
 bool UMounteaInventoryStatics::IncreaseItemQuantity(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target, const FGuid& ItemGuid, const int32 Amount)
 {
 	return Target.GetObject() ? Target->Execute_IncreaseItemQuantity(Target.GetObject(), ItemGuid, Amount) : false;
@@ -284,6 +302,32 @@ bool UMounteaInventoryStatics::ModifyItemDurability(const TScriptInterface<IMoun
 	return Target.GetObject() ? Target->Execute_ModifyItemDurability(Target.GetObject(), ItemGuid, DeltaDurability) : false;
 }
 
+FInventoryCapacityLimits UMounteaInventoryStatics::GetCapacityLimits(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target)
+{
+	return Target.GetObject() ? Target->Execute_GetCapacityLimits(Target.GetObject()) : FInventoryCapacityLimits();
+}
+
+void UMounteaInventoryStatics::SetCapacityLimits(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target, const FInventoryCapacityLimits& NewLimits)
+{
+	if (Target.GetObject())
+		Target->Execute_SetCapacityLimits(Target.GetObject(), NewLimits);
+}
+
+float UMounteaInventoryStatics::GetCurrentWeight(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target)
+{
+	return Target.GetObject() ? Target->Execute_GetCurrentWeight(Target.GetObject()) : 0.f;
+}
+
+int32 UMounteaInventoryStatics::GetOccupiedSlots(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target)
+{
+	return Target.GetObject() ? Target->Execute_GetOccupiedSlots(Target.GetObject()) : 0;
+}
+
+int32 UMounteaInventoryStatics::GetCategoryQuantity(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target, const FString& CategoryId)
+{
+	return Target.GetObject() ? Target->Execute_GetCategoryQuantity(Target.GetObject(), CategoryId) : 0;
+}
+
 void UMounteaInventoryStatics::ProcessInventoryNotification(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target, const FInventoryNotificationData& Notification)
 {
 	if (Target.GetObject())
@@ -319,12 +363,9 @@ FString UMounteaInventoryStatics::InventoryItemToString(const FMounteaInventoryI
 FInventoryCategory UMounteaInventoryStatics::GetInventoryCategory(const FMounteaInventoryItem& Item)
 {
 	if (!Item.Template) return FInventoryCategory();
-	const auto settings = GetDefault<UMounteaAdvancedInventorySettings>();
-	if (!settings) return FInventoryCategory();
-	const auto advancedInventorySettingsConfig = settings->AdvancedInventorySettingsConfig.LoadSynchronous();
-	if (!advancedInventorySettingsConfig) return FInventoryCategory();
-	const auto categoryKey = Item.Template->ItemCategory;
-	return advancedInventorySettingsConfig->AllowedCategories.Contains(categoryKey) ? advancedInventorySettingsConfig->AllowedCategories.FindChecked(categoryKey) : FInventoryCategory();
+	if (!FMounteaAdvancedInventorySettingsCache::GetInventoryConfig()) return FInventoryCategory();
+	const FInventoryCategory* inventoryCategory = FMounteaAdvancedInventorySettingsCache::FindCategory(Item.Template->ItemCategory);
+	return inventoryCategory ? *inventoryCategory : FInventoryCategory();
 }
 
 FString UMounteaInventoryStatics::GetInventoryCategoryKey(const FMounteaInventoryItem& Item)
@@ -336,12 +377,9 @@ FString UMounteaInventoryStatics::GetInventoryCategoryKey(const FMounteaInventor
 FInventoryRarity UMounteaInventoryStatics::GetInventoryRarity(const FMounteaInventoryItem& Item)
 {
 	if (!Item.Template) return FInventoryRarity();
-	const auto settings = GetDefault<UMounteaAdvancedInventorySettings>();
-	if (!settings) return FInventoryRarity();
-	const auto advancedInventorySettingsConfig = settings->AdvancedInventorySettingsConfig.LoadSynchronous();
-	if (!advancedInventorySettingsConfig) return FInventoryRarity();
-	const auto rarityKey = Item.Template->ItemRarity;
-	return advancedInventorySettingsConfig->AllowedRarities.Contains(rarityKey) ? advancedInventorySettingsConfig->AllowedRarities.FindChecked(rarityKey) : FInventoryRarity();
+	if (!FMounteaAdvancedInventorySettingsCache::GetInventoryConfig()) return FInventoryRarity();
+	const FInventoryRarity* inventoryRarity = FMounteaAdvancedInventorySettingsCache::FindRarity(Item.Template->ItemRarity);
+	return inventoryRarity ? *inventoryRarity : FInventoryRarity();
 }
 
 FString UMounteaInventoryStatics::GetInventoryRarityKey(const FMounteaInventoryItem& Item)
@@ -436,55 +474,24 @@ TArray<FMounteaInventoryItem> UMounteaInventoryStatics::SortInventoryItems(const
 	if (Items.Num() == 1)
 		return Items;
 
-	TArray<FMounteaInventoryItem> returnValue = Items;
-	enum class ESortKey : uint8 { Name, Value, Weight, Rarity, Unknown };
-	
-	auto getSortKey = [](const FString& Key) -> ESortKey
-	{
-		if (Key.Equals(TEXT("Name"), ESearchCase::IgnoreCase)) return ESortKey::Name;
-		if (Key.Equals(TEXT("Value"), ESearchCase::IgnoreCase)) return ESortKey::Value;
-		if (Key.Equals(TEXT("Weight"), ESearchCase::IgnoreCase)) return ESortKey::Weight;
-		if (Key.Equals(TEXT("Rarity"), ESearchCase::IgnoreCase)) return ESortKey::Rarity;
-		return ESortKey::Unknown;
-	};
-	
-	TArray<FInventorySortCriteria> sortedCriteria = SortingCriteria;
-	sortedCriteria.Sort([](const FInventorySortCriteria& A, const FInventorySortCriteria& B)
+	const FMounteaInventoryItemSortSpec sortSpec = FMounteaInventoryItemSortSpec::Make(SortingCriteria);
+	if (sortSpec.IsEmpty())
+		return Items;
+
+	TArray<TPair<int32, FMounteaInventoryItemSortKey>> sortRecords;
+	sortRecords.Reserve(Items.Num());
+	for (int32 i = 0; i < Items.Num(); ++i)
+		sortRecords.Emplace(i, FMounteaInventoryItemSortKey::Make(Items[i], sortSpec));
+
+	Algo::StableSort(sortRecords, [&sortSpec](const TPair<int32, FMounteaInventoryItemSortKey>& A, const TPair<int32, FMounteaInventoryItemSortKey>& B)
 	{
-		return A.SortPriority > B.SortPriority;
+		return FMounteaInventoryItemSortKey::Compare(sortSpec, A.Value, B.Value) < 0;
 	});
-	
-	for (const FInventorySortCriteria& Criteria : sortedCriteria)
-	{
-		const ESortKey sortKey = getSortKey(Criteria.SortingKey);
-		
-		Algo::StableSort(returnValue, [sortKey](const FMounteaInventoryItem& A, const FMounteaInventoryItem& B)
-		{
-			switch (sortKey)
-			{
-				case ESortKey::Name:
-				return GetInventoryItemName(A).ToString().Compare(GetInventoryItemName(B).ToString()) < 0;
-				
-				case ESortKey::Value:
-					if (!A.Template || !B.Template) return false;
-					return A.Template->BasePrice * A.GetQuantity() < B.Template->BasePrice * B.GetQuantity();
-					
-				case ESortKey::Weight:
-					if (!A.Template || !B.Template) return false;
-					return A.Template->Weight * A.GetQuantity() < B.Template->Weight * B.GetQuantity();
-					
-				case ESortKey::Rarity:
-					{
-						FInventoryRarity RarityA = GetInventoryRarity(A);
-						FInventoryRarity RarityB = GetInventoryRarity(B);
-						return RarityA.RarityPriority < RarityB.RarityPriority;
-					}
-				
-				default:
-					return false;
-			}
-		});
-	}
+
+	TArray<FMounteaInventoryItem> returnValue;
+	returnValue.Reserve(sortRecords.Num());
+	for (const TPair<int32, FMounteaInventoryItemSortKey>& sortRecord : sortRecords)
+		returnValue.Add(Items[sortRecord.Key]);
 	
 	return returnValue;
 }
@@ -605,18 +612,29 @@ FInventoryNotificationData UMounteaInventoryStatics::CreateNotificationData(
 	const int32 QuantityDelta
 )
 {
-	const UMounteaAdvancedInventorySettingsConfig* Config = GetDefault<UMounteaAdvancedInventorySettings>()->AdvancedInventorySettingsConfig.LoadSynchronous();
-	if (!Config) return FInventoryNotificationData();
-
-	const FInventoryNotificationConfig* NotifConfig = Config->NotificationConfigs.Find(Type);
-	if (!NotifConfig) return FInventoryNotificationData();
-
+	if (!SourceInventory.GetObject()) return FInventoryNotificationData();
+	
 	auto inventoryItem = SourceInventory->Execute_FindItem(SourceInventory.GetObject(), FInventoryItemSearchParams(ItemGuid));
 	/* if (!inventoryItem.IsItemValid()) return FInventoryNotificationData();*/ // TODO: How to process failed Item?
+	if (!inventoryItem.GetGuid().IsValid())
+		inventoryItem.SetGuid(ItemGuid);
+
+	return CreateNotificationData(Type, SourceInventory, inventoryItem, QuantityDelta);
+}
+
+FInventoryNotificationData UMounteaInventoryStatics::CreateNotificationData(
+	const FString& Type,
+	const TScriptInterface<IMounteaAdvancedInventoryInterface>& SourceInventory,
+	const FMounteaInventoryItem& Item,
+	const int32 QuantityDelta
+)
+{
+	const FInventoryNotificationConfig* NotifConfig = FMounteaAdvancedInventorySettingsCache::FindNotificationConfig(Type);
+	if (!NotifConfig) return FInventoryNotificationData();
 
 	FText notificationText = NotifConfig->MessageTemplate;
 	notificationText = UMounteaInventorySystemStatics::ReplaceRegexInText(TEXT("${quantity}"), FText::AsNumber(FMath::Abs(QuantityDelta)), notificationText);
-	notificationText = UMounteaInventorySystemStatics::ReplaceRegexInText(TEXT("${itemName}"), inventoryItem.GetItemName(), notificationText);
+	notificationText = UMounteaInventorySystemStatics::ReplaceRegexInText(TEXT("${itemName}"), Item.GetItemName(), notificationText);
 
 	
 	return FInventoryNotificationData(
@@ -624,7 +642,7 @@ FInventoryNotificationData UMounteaInventoryStatics::CreateNotificationData(
 		NotifConfig->NotificationCategory,
 		NotifConfig->MessageTitle,
 		notificationText,
-		ItemGuid,
+		Item.GetGuid(),
 		SourceInventory,
 		FMath::Abs(QuantityDelta),
 		NotifConfig->DefaultDuration,
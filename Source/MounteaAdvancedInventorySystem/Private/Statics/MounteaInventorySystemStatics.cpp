@@ -17,6 +17,7 @@
 #include "Logs/MounteaAdvancedInventoryLog.h"
 #include "Settings/MounteaAdvancedInventorySettingsConfig.h"
 #include "Settings/MounteaAdvancedInventorySettings.h"
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
 
 bool UMounteaInventorySystemStatics::CanExecuteCosmeticEvents(const UWorld* WorldContext)
 {
@@ -37,8 +38,7 @@ UObject* UMounteaInventorySystemStatics::GetObjectByClass(UObject* Object, const
 
 UMounteaAdvancedInventorySettingsConfig* UMounteaInventorySystemStatics::GetMounteaAdvancedInventoryConfig()
 {
-	auto settings = GetDefault<UMounteaAdvancedInventorySettings>();
-	return settings ? settings->AdvancedInventorySettingsConfig.LoadSynchronous() : nullptr;
+	return FMounteaAdvancedInventorySettingsCache::GetInventoryConfig();
 }
 
 FText UMounteaInventorySystemStatics::ReplaceRegexInText(const FString& Regex, const FText& Replacement, const FText& SourceText)
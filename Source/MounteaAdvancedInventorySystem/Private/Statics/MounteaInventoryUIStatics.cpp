@@ -46,6 +46,7 @@
 #include "Interfaces/Inventory/MounteaAdvancedInventoryUIManagerInterface.h"
 
 #include "Settings/MounteaAdvancedInventorySettings.h"
+#include "Settings/MounteaAdvancedInventorySettingsCache.h"
 #include "Settings/MounteaAdvancedInventorySettingsConfig.h"
 #include "Settings/MounteaAdvancedInventoryGlobalUIConfig.h"
 #include "Settings/MounteaAdvancedInventoryUIConfig.h"
@@ -1329,10 +1330,7 @@ int32 UMounteaInventoryUIStatics::Helper_FindEmptyGridSlotIndex(const UWidget* T
 	const bool bHasInventoryInterface = ParentInventory->Implements<UMounteaAdvancedInventoryInterface>();
 	if (!bHasUIInterface && !bHasInventoryInterface) return INDEX_NONE;
 
-	auto settings = GetMutableDefault<UMounteaAdvancedInventorySettings>();
-	if (!IsValid(settings)) return INDEX_NONE;
-
-	auto config = settings->AdvancedInventorySettingsConfig.LoadSynchronous();
+	auto config = FMounteaAdvancedInventorySettingsCache::GetInventoryConfig();
 	if (!IsValid(config)) return INDEX_NONE;
 	
 	UObject* inventoryObject = nullptr;
@@ -1454,8 +1452,7 @@ bool UMounteaInventoryUIStatics::Helper_ItemsGrid_UpdateItemInSlot(UUserWidget*
 	const auto item = parentInventory->Execute_FindItem(parentInventory.GetObject(), FInventoryItemSearchParams(ItemId));
 	if (!item.IsItemValid()) return false;
 
-	const auto settings = GetMutableDefault<UMounteaAdvancedInventorySettings>();
-	const auto config = settings ? settings->AdvancedInventorySettingsConfig.LoadSynchronous() : nullptr;
+	const auto config = FMounteaAdvancedInventorySettingsCache::GetInventoryConfig();
 		
 	const bool bIsStackable = UMounteaInventoryStatics::HasInventoryFlags(
 		item.Template->ItemFlags, static_cast<int32>(EInventoryItemFlags::EIIF_Stackable)
@@ -12,6 +12,7 @@
 
 #include "Statics/MounteaLoadoutStatics.h"
 
+#include "Definitions/MounteaAdvancedInventoryLoadoutItem.h"
 #include "Interfaces/Loadouts/MounteaAdvancedInventoryLoadoutsInterface.h"
 
 bool UMounteaLoadoutStatics::IsValidLoadout(const UObject* Target)
@@ -24,6 +25,23 @@ bool UMounteaLoadoutStatics::LoadLoadout(UObject* Target)
 	return IsValidLoadout(Target) ? IMounteaAdvancedInventoryLoadoutsInterface::Execute_LoadLoadout(Target) : false;
 }
 
+bool UMounteaLoadoutStatics::LoadLoadoutWithSeed(UObject* Target, const int32 RandomSeed)
+{
+	return IsValidLoadout(Target) ? IMounteaAdvancedInventoryLoadoutsInterface::Execute_LoadLoadoutWithSeed(Target, RandomSeed) : false;
+}
+
+TArray<int32> UMounteaLoadoutStatics::ResolveLoadoutQuantities(const TArray<UMounteaAdvancedInventoryLoadoutItem*>& Items, const int32 RandomSeed)
+{
+	FRandomStream randomStream(RandomSeed);
+
+	TArray<int32> quantities;
+	quantities.Reserve(Items.Num());
+	for (const UMounteaAdvancedInventoryLoadoutItem* item : Items)
+		quantities.Add(IsValid(item) ? item->ResolveQuantity(randomStream) : 0);
+
+	return quantities;
+}
+
 UMounteaAdvancedInventoryLoadoutConfig* UMounteaLoadoutStatics::GetLoadout(UObject* Target)
 {
 	return IsValidLoadout(Target) ? IMounteaAdvancedInventoryLoadoutsInterface::Execute_GetLoadout(Target) : nullptr;
@@ -0,0 +1,141 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+
+#include "Subsystems/MounteaEquipmentActorPoolSubsystem.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Interfaces/Equipment/MounteaAdvancedPooledActorInterface.h"
+
+namespace MounteaEquipmentActorPool
+{
+	/** Notifies actor and its components implementing the pooled actor interface. */
+	static void NotifyPooledActor(AActor* Actor, const bool bAcquired)
+	{
+		TArray<UObject*> pooledObjects;
+		pooledObjects.Add(Actor);
+		for (UActorComponent* actorComponent : Actor->GetComponents())
+			pooledObjects.Add(actorComponent);
+
+		for (UObject* pooledObject : pooledObjects)
+		{
+			if (!IsValid(pooledObject) || !pooledObject->Implements<UMounteaAdvancedPooledActorInterface>())
+				continue;
+
+			if (bAcquired)
+				IMounteaAdvancedPooledActorInterface::Execute_OnAcquiredFromPool(pooledObject);
+			else
+				IMounteaAdvancedPooledActorInterface::Execute_OnReleasedToPool(pooledObject);
+		}
+	}
+}
+
+void UMounteaEquipmentActorPoolSubsystem::Deinitialize()
+{
+	// World tears its actors down on its own
+	PooledActors.Empty();
+
+	Super::Deinitialize();
+}
+
+AActor* UMounteaEquipmentActorPoolSubsystem::AcquireActor(UClass* ActorClass, const FActorSpawnParameters& SpawnParams)
+{
+	if (!IsValid(ActorClass))
+		return nullptr;
+
+	UWorld* world = GetWorld();
+	if (!IsValid(world))
+		return nullptr;
+
+	if (FMounteaPooledEquipmentActors* pooledActors = PooledActors.Find(ActorClass))
+	{
+		while (!pooledActors->Actors.IsEmpty())
+		{
+			AActor* pooledActor = pooledActors->Actors.Pop(EAllowShrinking::No);
+			if (!IsValid(pooledActor))
+				continue;
+
+			const AActor* defaultActor = ActorClass->GetDefaultObject<AActor>();
+			pooledActor->SetOwner(SpawnParams.Owner);
+			pooledActor->SetActorTransform(FTransform::Identity, false, nullptr, ETeleportType::ResetPhysics);
+			pooledActor->SetActorHiddenInGame(defaultActor->IsHidden());
+			pooledActor->SetActorEnableCollision(defaultActor->GetActorEnableCollision());
+			pooledActor->SetActorTickEnabled(defaultActor->PrimaryActorTick.bStartWithTickEnabled);
+			MounteaEquipmentActorPool::NotifyPooledActor(pooledActor, true);
+			return pooledActor;
+		}
+	}
+
+	return world->SpawnActor<AActor>(ActorClass, FTransform::Identity, SpawnParams);
+}
+
+bool UMounteaEquipmentActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!IsValid(Actor))
+		return false;
+
+	// Actors from other worlds never get pooled, do not create empty pools for them
+	if (Actor->GetWorld() != GetWorld())
+	{
+		Actor->Destroy();
+		return false;
+	}
+
+	FMounteaPooledEquipmentActors& pooledActors = PooledActors.FindOrAdd(Actor->GetClass());
+	if (pooledActors.Actors.Num() >= MaxPooledActorsPerClass)
+	{
+		Actor->Destroy();
+		return false;
+	}
+
+	MounteaEquipmentActorPool::NotifyPooledActor(Actor, false);
+
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+	Actor->SetOwner(nullptr);
+
+	pooledActors.Actors.AddUnique(Actor);
+	return true;
+}
+
+void UMounteaEquipmentActorPoolSubsystem::ClearPool()
+{
+	for (TPair<TObjectPtr<UClass>, FMounteaPooledEquipmentActors>& pooledActors : PooledActors)
+	{
+		for (AActor* pooledActor : pooledActors.Value.Actors)
+		{
+			if (IsValid(pooledActor))
+				pooledActor->Destroy();
+		}
+	}
+
+	PooledActors.Empty();
+}
+
+int32 UMounteaEquipmentActorPoolSubsystem::GetPooledActorsCount(const TSubclassOf<AActor> ActorClass) const
+{
+	const FMounteaPooledEquipmentActors* pooledActors = PooledActors.Find(ActorClass.Get());
+	return pooledActors ? pooledActors->Actors.Num() : 0;
+}
+
+UMounteaEquipmentActorPoolSubsystem* UMounteaEquipmentActorPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* world = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+	return IsValid(world) ? world->GetSubsystem<UMounteaEquipmentActorPoolSubsystem>() : nullptr;
+}
+
+bool UMounteaEquipmentActorPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
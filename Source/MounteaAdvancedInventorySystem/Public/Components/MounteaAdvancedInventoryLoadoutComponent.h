@@ -13,6 +13,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Engine/StreamableManager.h"
 #include "Interfaces/Loadouts/MounteaAdvancedInventoryLoadoutsInterface.h"
 #include "MounteaAdvancedInventoryLoadoutComponent.generated.h"
 
@@ -45,6 +46,8 @@ public:
 	
 	
 	virtual bool LoadLoadout_Implementation() override;
+
+	virtual bool LoadLoadoutWithSeed_Implementation(const int32 RandomSeed) override;
 	
 	virtual UMounteaAdvancedInventoryLoadoutConfig* GetLoadout_Implementation() const override
 	{ return LoadoutConfiguration.LoadSynchronous(); };
@@ -71,11 +74,33 @@ protected:
 	 * Resolves and caches related inventory/equipment interfaces from the owner.
 	 */
 	void InitializeInventoryAndEquipment();
+
+	/**
+	 * Streams in equipment Spawn Actor classes of the loadout, then applies it.
+	 * Loadout is applied right away if everything is already loaded.
+	 */
+	bool RequestLoadoutAssets();
+
+	/**
+	 * Adds all loadout items to inventory in single transaction and equips them in single pass.
+	 * Expects loadout configuration and equipment classes to be loaded.
+	 */
+	bool ApplyLoadout();
+
+	void OnLoadoutConfigurationLoaded();
+	void OnLoadoutAssetsLoaded();
 	
 	/**
 	 * Initializes runtime references and optionally auto-loads loadout on authority.
 	 */
 	virtual void BeginPlay() override;
+
+	/**
+	 * Cancels loadout asset loading in progress.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	
 protected:
 	
@@ -119,4 +144,33 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Configuration",
 		meta=(NoResetToDefault))
 	uint8 bAutoLoad : 1;
+
+	/**
+	 * If true, Load Loadout always uses Fixed Random Seed, so random quantities are the same every time.
+	 * Otherwise new seed is picked on authority for each load.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Configuration",
+		meta=(NoResetToDefault))
+	uint8 bUseFixedRandomSeed : 1;
+
+	/**
+	 * Seed used for random quantities when Use Fixed Random Seed is enabled.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Configuration",
+		meta=(NoResetToDefault),
+		meta=(EditCondition="bUseFixedRandomSeed"))
+	int32 FixedRandomSeed;
+
+	/**
+	 * Seed of the last requested loadout.
+	 *
+	 * Quantities of random loadout items are fully determined by this seed, so it is all that needs
+	 * to be shared to reproduce the granted loadout. Picked on authority and replicated to clients.
+	 */
+	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category="Configuration",
+		meta=(NoResetToDefault))
+	int32 ActiveRandomSeed;
+
+	/** Keeps loadout configuration and equipment classes loaded until the loadout is applied. */
+	TSharedPtr<FStreamableHandle> LoadoutLoadHandle;
 };
@@ -46,6 +46,7 @@ public:
 protected:
 	
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 	virtual bool ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags) override;
 	virtual void GetLifetimeReplicatedProps(TArray<class FLifetimeProperty>& OutLifetimeProps) const override;
@@ -74,6 +75,29 @@ public:
 	{ return AttachmentSlots; };
 	void ApplyParentContainer();
 
+	/**
+	 * Adds new slot to the container and registers it for replication. Authority only.
+	 * Slots added to AttachmentSlots directly are not registered for replication.
+	 * @param NewSlot Slot to add, should be outered to this container. Its name must be unique within the container
+	 * @return True if slot was added
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Attachment Container")
+	bool AddAttachmentSlot(UMounteaAdvancedAttachmentSlot* NewSlot);
+
+	/**
+	 * Detaches and removes slot from the container and unregisters it from replication. Authority only.
+	 * @param SlotId Name of the slot to remove
+	 * @return True if slot was removed
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Attachment Container")
+	bool RemoveAttachmentSlot(const FName& SlotId);
+
+	/**
+	 * Requests slot name index rebuild on next lookup. Call after renaming a slot in place.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Attachment Container")
+	void MarkSlotIndicesDirty();
+
 	virtual FOnAttachmentChanged& GetOnAttachmentChangedEventHandle() override
 	{ return OnAttachmentChanged; };
 	virtual FOnSlotStateChanged& GetOnSlotStateChangedEventHandle() override
@@ -88,6 +112,26 @@ protected:
 	bool TryAttachInternal(const FName& SlotId, UObject* Attachment);
 	UFUNCTION(Server, Reliable)
 	void Server_TryDetach(const FName& SlotId);
+
+	UFUNCTION()
+	void OnRep_AttachmentSlots();
+
+	/**
+	 * Registers slots not yet in replicated subobject list and unregisters slots no longer in AttachmentSlots.
+	 * Slots are registered once instead of on every replication pass.
+	 */
+	void SyncReplicatedSlots();
+
+	/** Rebuilds SlotIndices from AttachmentSlots. */
+	void RebuildSlotIndices() const;
+
+	/**
+	 * Finds slot by name without scanning AttachmentSlots.
+	 * Index is rebuilt only when marked dirty or when the number of AttachmentSlots changed since it was built.
+	 * @param SlotId Name of the slot
+	 * @return Slot with matching name, nullptr if not found
+	 */
+	UMounteaAdvancedAttachmentSlot* FindSlotByName(const FName& SlotId) const;
 	
 public:
 	
@@ -98,7 +142,7 @@ public:
 	 * configuration. Slot objects are instanced on the component, persisted in SaveGame data,
 	 * and replicated so attachment state is synchronized in multiplayer sessions.
 	 */
-	UPROPERTY(SaveGame, Replicated, EditAnywhere, BlueprintReadWrite, Category="Mountea|Attachment Container",
+	UPROPERTY(SaveGame, ReplicatedUsing=OnRep_AttachmentSlots, EditAnywhere, BlueprintReadWrite, Category="Mountea|Attachment Container",
 		Instanced,
 		meta=(TitleProperty="DisplayName"),
 		meta=(NoResetToDefault),
@@ -166,6 +210,19 @@ protected:
 	UFUNCTION()
 	TArray<FName> GetAvailableTargetNames() const;
 
+	/** Index of first slot with given name in AttachmentSlots. */
+	mutable TMap<FName, int32> SlotIndices;
+
+	/** Number of AttachmentSlots when SlotIndices were built, INDEX_NONE if never built. */
+	mutable int32 IndexedSlotsNum = INDEX_NONE;
+
+	/** Set when slots are added, removed or renamed, SlotIndices are rebuilt on next lookup. */
+	mutable bool bSlotIndicesDirty = true;
+
+	/** Slots currently registered in replicated subobject list. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UMounteaAdvancedAttachmentSlot>> ReplicatedSlots;
+
 protected:
 
 #if WITH_EDITOR
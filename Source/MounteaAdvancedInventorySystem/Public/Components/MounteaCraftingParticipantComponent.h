@@ -13,12 +13,16 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Definitions/MounteaCraftingBaseDataTypes.h"
+#include "Engine/StreamableManager.h"
 #include "Interfaces/Crafting/MounteaAdvancedCraftingParticipantInterface.h"
 #include "MounteaCraftingParticipantComponent.generated.h"
 
 class IMounteaAdvancedCraftingStationInterface;
 struct FMounteaCraftingResult;
 class IMounteaAdvancedInventoryInterface;
+class UMounteaInventoryItemTemplate;
+struct FMounteaInventoryItem;
 
 /**
  * UMounteaCraftingParticipantComponent represents an actor capable of interacting with crafting stations.
@@ -42,6 +46,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	void InitializeInventoryAndEquipment();
 
@@ -51,6 +56,13 @@ protected:
 	UFUNCTION()
 	void OnRep_CraftingStation();
 
+	UFUNCTION()
+	void OnParentInventoryItemAdded(const FMounteaInventoryItem& AddedItem);
+	UFUNCTION()
+	void OnParentInventoryItemRemoved(const FMounteaInventoryItem& RemovedItem);
+	UFUNCTION()
+	void OnParentInventoryItemQuantityChanged(const FMounteaInventoryItem& Item, int32 OldQuantity, int32 NewQuantity);
+
 public:
 
 	virtual TArray<UMounteaRecipeTemplate*> GetKnownRecipes_Implementation() const override;
@@ -60,7 +72,9 @@ public:
 	virtual bool LearnRecipe_Implementation(UMounteaRecipeTemplate* RecipeTemplate) override;
 	virtual bool ForgetRecipe_Implementation(UMounteaRecipeTemplate* RecipeTemplate) override;
 	virtual bool IsCraftingPossible_Implementation(UMounteaRecipeTemplate* TemplateToCraft) const override;
+	virtual FMounteaRecipeCraftability GetRecipeCraftability_Implementation(UMounteaRecipeTemplate* RecipeTemplate) const override;
 	virtual FMounteaCraftingResult StartCrafting_Implementation(UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients) override;
+	virtual FMounteaCraftingResult StartCraftingMultiple_Implementation(UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients, const int32 CraftCount) override;
 	virtual TScriptInterface<IMounteaAdvancedInventoryInterface> GetParentInventory_Implementation() const override
 	{
 		return RelatedInventory;
@@ -87,7 +101,22 @@ public:
 	}
 
 protected:
-	static TArray<UMounteaRecipeTemplate*> ResolveKnownRecipeTemplates(const TArray<FGuid>& KnownRecipeGuids);
+	/** Resolves templates of all known recipes from allowed recipes in Crafting Config. */
+	void RebuildKnownRecipeTemplates();
+
+	/** Re-resolves known recipes once allowed recipes change, e.g. when recipes missing registry tags finish indexing. */
+	void OnAllowedRecipesChanged();
+
+	/**
+	 * Rebuilds craftability of all known recipes from the whole parent Inventory.
+	 * Ingredient templates which are not loaded yet are streamed in and the cache is rebuilt once they arrive.
+	 */
+	void RebuildCraftabilityCache();
+
+	void OnCraftabilityIngredientsLoaded();
+
+	/** Updates craftability of recipes using Item's template after its quantity in parent Inventory changed. */
+	void ApplyIngredientQuantityDelta(const FMounteaInventoryItem& Item, const int32 QuantityDelta);
 
 public:
 
@@ -120,6 +149,32 @@ public:
 		meta=(DisplayThumbnail=false))
 	TScriptInterface<IMounteaAdvancedCraftingStationInterface> CraftingStation;
 
+protected:
+
+	/** Templates of known recipes, indexed by recipe Guid. Kept in sync with KnownRecipes. */
+	UPROPERTY(Transient)
+	TMap<FGuid, TObjectPtr<UMounteaRecipeTemplate>> KnownRecipeTemplates;
+
+	/** Craftability per known recipe Guid, updated from parent Inventory item events. */
+	UPROPERTY(Transient)
+	TMap<FGuid, FMounteaRecipeCraftability> RecipeCraftability;
+
+	/** Total parent Inventory quantity of every template used as ingredient by known recipes. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UMounteaInventoryItemTemplate>, int32> IngredientQuantities;
+
+	/** Known recipe Guids per ingredient template. */
+	TMap<TObjectPtr<UMounteaInventoryItemTemplate>, TArray<FGuid>> RecipesByIngredient;
+
+	/** Ingredient templates already requested for loading, failed loads are not requested again. */
+	TSet<FSoftObjectPath> RequestedIngredientPaths;
+
+	/** Keeps streamed ingredient templates of known recipes loaded. */
+	TArray<TSharedPtr<FStreamableHandle>> IngredientLoadHandles;
+
+	/** Handle of settings cache recipes changed binding. */
+	FDelegateHandle RecipesChangedHandle;
+
 protected:
 
 	UFUNCTION(Server, Reliable)
@@ -131,6 +186,9 @@ protected:
 	UFUNCTION(Server, Reliable)
 	void Server_StartCrafting(UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients);
 
+	UFUNCTION(Server, Reliable)
+	void Server_StartCraftingMultiple(UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients, const int32 CraftCount);
+
 	UFUNCTION(Server, Reliable)
 	void Server_StartUsingCraftingStation(const TScriptInterface<IMounteaAdvancedCraftingStationInterface>& Station);
 
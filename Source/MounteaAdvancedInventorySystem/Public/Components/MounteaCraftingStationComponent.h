@@ -13,11 +13,15 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Definitions/MounteaCraftingBaseDataTypes.h"
 #include "Interfaces/Crafting/MounteaAdvancedCraftingStationInterface.h"
 #include "MounteaCraftingStationComponent.generated.h"
 
 class IMounteaAdvancedCraftingParticipantInterface;
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCraftingJobsChanged);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCraftingJobRejected, const FGuid&, JobGuid);
+
 /**
  * UMounteaCraftingStationComponent represents a world-placed crafting workstation.
  * It tracks occupancy state and manages participants interacting with it,
@@ -43,9 +47,14 @@ protected:
 	virtual void BeginPlay() override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	UFUNCTION()
 	void OnRep_CraftingStationState();
 
+	UFUNCTION()
+	void OnRep_CraftingJobs();
+
 public:
 
 	virtual FGameplayTag GetCraftingPlaceType_Implementation() const override
@@ -65,9 +74,33 @@ public:
 	virtual bool CanBeUsed_Implementation() const override;
 	virtual bool StartUsing_Implementation(const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant) override;
 	virtual bool StopUsing_Implementation(const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant) override;
+	virtual FGuid EnqueueCraftingJob_Implementation(const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant, UMounteaRecipeTemplate* Recipe, UMounteaRecipeIngredientsList* Ingredients, const int32 Quantity) override;
+	virtual bool CancelCraftingJob_Implementation(const FGuid& JobGuid) override;
+	virtual TArray<FMounteaCraftingJob> GetCraftingJobs_Implementation() const override
+	{
+		return CraftingJobs;
+	}
+	virtual float GetCraftingJobProgress_Implementation(const FGuid& JobGuid) const override;
+
+protected:
+
+	/** Server and client synchronized world time used for job timestamps. */
+	double GetCraftingTime() const;
+
+	/** Crafts every unit which is due, starts next job and schedules timer for next unit. Server only. */
+	void AdvanceCraftingJobs();
+
+	void ScheduleNextCraftingJob();
 
 public:
 
+	UPROPERTY(BlueprintAssignable, Category="Crafting")
+	FOnCraftingJobsChanged OnCraftingJobsChanged;
+
+	/** Called on requesting client when server refused job with provisional Guid returned by Enqueue Crafting Job. */
+	UPROPERTY(BlueprintAssignable, Category="Crafting")
+	FOnCraftingJobRejected OnCraftingJobRejected;
+
 	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="Crafting",
 		meta=(Categories="Mountea_Inventory.Crafting,Crafting"),
 		meta=(NoResetToDefault))
@@ -89,6 +122,14 @@ private:
 		meta=(AllowPrivateAccess))
 	TArray<TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>> CraftingParticipants;
 
+	/** Queued jobs, first job is the running one. Replicated only when jobs are queued, advanced or finished. */
+	UPROPERTY(ReplicatedUsing=OnRep_CraftingJobs, Transient, VisibleAnywhere, BlueprintReadOnly, Category="Crafting",
+		meta=(NoResetToDefault),
+		meta=(AllowPrivateAccess))
+	TArray<FMounteaCraftingJob> CraftingJobs;
+
+	FTimerHandle CraftingJobTimerHandle;
+
 protected:
 
 	UFUNCTION(Server, Reliable)
@@ -99,4 +140,17 @@ protected:
 
 	UFUNCTION(Server, Reliable)
 	void Server_SetCraftingStationState(ECraftingStationState NewState);
+
+	UFUNCTION(Server, Reliable)
+	void Server_EnqueueCraftingJob(const FGuid& JobGuid, const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant, UMounteaRecipeTemplate* Recipe, UMounteaRecipeIngredientsList* Ingredients, const int32 Quantity);
+
+	UFUNCTION(Server, Reliable)
+	void Server_CancelCraftingJob(const FGuid& JobGuid);
+
+	UFUNCTION(Client, Reliable)
+	void Client_CraftingJobRejected(const FGuid& JobGuid);
+
+private:
+
+	bool EnqueueCraftingJobInternal(const FGuid& JobGuid, const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant, UMounteaRecipeTemplate* Recipe, UMounteaRecipeIngredientsList* Ingredients, const int32 Quantity);
 };
@@ -43,9 +43,16 @@ class MOUNTEAADVANCEDINVENTORYSYSTEM_API UMounteaEquipmentComponent : public UMo
 {
 	GENERATED_BODY()
 
+	friend class UMounteaEquipmentStatics;
+
 public:
 
 	UMounteaEquipmentComponent();
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 public:
 	
@@ -62,12 +69,48 @@ public:
 	virtual bool AnimQuickItemUsed_Implementation() override;
 	virtual bool TryGetPendingEquipmentActivation(FPendingEquipmentActivation& OutPendingActivation) const override;
 
+	virtual bool TryAttach_Implementation(const FName& SlotId, UObject* Attachment) override;
+	virtual bool TryDetach_Implementation(const FName& SlotId) override;
+	virtual bool ForceAttach_Implementation(const FName& SlotId, UObject* Attachment) override;
+	virtual bool ForceDetach_Implementation(const FName& SlotId) override;
+	virtual void ClearAll_Implementation() override;
+
+	/**
+	 * Finds slot holding equipped item with given GUID.
+	 * Uses GUID to slot map, which is rebuilt only after attachments change.
+	 *
+	 * @param ItemGuid  GUID of the equipped item.
+	 * @param OutInterface  Equipment item interface of the attachment, if found.
+	 * @return  Slot holding the item, or nullptr if the item is not equipped.
+	 */
+	UMounteaAdvancedAttachmentSlot* FindSlotByEquippedItemGuid(const FGuid& ItemGuid,
+		TScriptInterface<IMounteaAdvancedEquipmentItemInterface>& OutInterface) const;
+
+	/**
+	 * Returns inventories of the owning actor. Cached until any of them is destroyed or owner components change.
+	 * Empty result is never cached.
+	 *
+	 * @return  Inventory objects in lookup order.
+	 */
+	TArray<UObject*> GetOwningInventories() const;
+
 	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Equipment",
 		meta=(MounteaSetter),
 		meta=(ExpandBoolAsExecs="ReturnValue"),
 		DisplayName="Register Quick Use Placeholder Actor")
 	bool RegisterQuickUsePlaceholderActor(const FGuid& ItemGuid, AActor* PlaceholderActor);
 
+	/**
+	 * Checks whether equip request of the item is waiting for its SpawnActor class to load.
+	 *
+	 * @param ItemGuid  GUID of the item to check.
+	 * @return  True if equip of the item will complete once loading finishes.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Equipment",
+		meta=(MounteaValidate),
+		DisplayName="Is Equipment Load Pending")
+	bool IsEquipmentLoadPending(const FGuid& ItemGuid) const;
+
 protected:
 
 	bool BuildEquipmentTransitionContext(const FGuid& ItemGuid, const FName& TargetSlotId, EEquipmentItemState ExpectedState,
@@ -82,12 +125,17 @@ protected:
 	bool ShouldUseDeferredTransition(const FEquipmentTransitionContext& Context, EEquipmentTransitionType TransitionType) const;
 	bool ValidateEquipRequest(const FMounteaInventoryItem& ItemDefinition) const;
 	bool TryExecuteEquipOverride(const FMounteaInventoryItem& ItemDefinition, AActor*& OutSpawnedActor) const;
+	bool RequestEquipmentLoad(const FMounteaInventoryItem& ItemDefinition, const FName& TargetSlotId);
+	/** Cancels equip request waiting for SpawnActor class. Returns true if there was one. */
+	bool CancelEquipmentLoad(const FGuid& ItemGuid);
+	void OnEquipmentLoaded(FGuid ItemGuid);
+	AActor* EquipLoadedItem(const FMounteaInventoryItem& ItemDefinition, const FName& TargetSlotId);
 	void ArmPendingActivation(const FMounteaInventoryItem& ItemDefinition, const FEquipmentTransitionContext& Context,
 		EEquipmentTransitionType TransitionType, UAnimMontage* Montage = nullptr, float MontageDuration = -1.f);
 	double ResolvePendingTransitionTimeout(UAnimMontage* Montage, float MontageDuration) const;
 	bool IsPendingActivationExpired() const;
 	void ResetPendingActivationIfExpired();
-	bool IsTransitionInProgress(EEquipmentTransitionType RequestedTransitionType = EEquipmentTransitionType::EET_None) const;
+	bool IsTransitionInProgress(EEquipmentTransitionType RequestedTransitionType = EEquipmentTransitionType::EET_None, const FGuid& ItemGuid = FGuid()) const;
 	void SetCurrentTransitionType(EEquipmentTransitionType NewTransitionType);
 	void ResetCurrentTransitionType();
 	UAnimInstance* ResolveOwnerAnimInstance() const;
@@ -113,11 +161,33 @@ protected:
 
 	bool ConsumeQuickUsePlaceholderActor(const FGuid& ItemGuid, bool bIgnoreItemGuidMismatch);
 
+	/** Rebuilds EquippedItemSlots from current slot attachments. */
+	void RebuildEquippedItemSlots() const;
+	void MarkEquippedItemSlotsDirty();
+
+	UFUNCTION()
+	void OnEquipmentAttachmentChanged(const FName& SlotId, UObject* NewAttachment, UObject* OldAttachment);
+	UFUNCTION()
+	void OnOwningInventoryItemRemoved(const FMounteaInventoryItem& RemovedItem);
+
 	FPendingEquipmentActivation PendingActivation;
+
+	/** Equip requests waiting for SpawnActor class, keyed by item GUID. Referenced so item templates stay alive meanwhile. */
+	UPROPERTY(Transient)
+	TMap<FGuid, FPendingEquipmentLoad> PendingEquipmentLoads;
+
 	EEquipmentTransitionType CurrentTransitionType = EEquipmentTransitionType::EET_None;
 	TWeakObjectPtr<AActor> QuickUsePlaceholderActor;
 	FGuid QuickUsePlaceholderItemGuid;
 
+	/** Equipped item GUID to holding slot, rebuilt lazily when attachments change. */
+	mutable TMap<FGuid, TWeakObjectPtr<UMounteaAdvancedAttachmentSlot>> EquippedItemSlots;
+	mutable bool bEquippedItemSlotsDirty = true;
+
+	mutable TArray<TWeakObjectPtr<UObject>> CachedInventories;
+	mutable int32 CachedOwnerComponentCount = INDEX_NONE;
+	mutable bool bInventoriesCached = false;
+
 	UFUNCTION()
 	void OnTransitionMontageEnded(UAnimMontage* Montage, bool bInterrupted);
 
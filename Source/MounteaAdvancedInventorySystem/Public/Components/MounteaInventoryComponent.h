@@ -22,6 +22,15 @@ enum class EInventoryNotificationType : uint8;
 enum class EInventoryFlags : uint8;
 enum class EInventoryType : uint8;
 
+/** Notification data of a single item merged from all its changes within one frame. */
+struct FInventoryPendingNotification
+{
+	FMounteaInventoryItem Item;
+	int32 QuantityDelta = 0;
+	bool bAdded = false;
+	bool bRemoved = false;
+};
+
 /**
  * UMounteaInventoryComponent manages inventory item collections with network replication support.
  * Inventory components provide item storage, modification, searching, and notification systems
@@ -45,7 +54,9 @@ public:
 
 protected:
 
+	virtual void PostInitProperties() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 protected:
 
@@ -72,11 +83,41 @@ protected:
 	virtual bool ModifyItemDurability_Implementation(const FGuid& ItemGuid, const float DeltaDurability) override;
 	virtual void ClearInventory_Implementation() override;
 	virtual bool HasItem_Implementation(const FInventoryItemSearchParams& SearchParams) const override;
+	virtual bool ExecuteTransaction_Implementation(const TArray<FInventoryTransactionOperation>& Operations) override;
+	virtual FInventoryCapacityLimits GetCapacityLimits_Implementation() const override;
+	virtual void SetCapacityLimits_Implementation(const FInventoryCapacityLimits& NewLimits) override;
+	virtual float GetCurrentWeight_Implementation() const override;
+	virtual int32 GetOccupiedSlots_Implementation() const override;
+	virtual int32 GetCategoryQuantity_Implementation(const FString& CategoryId) const override;
 	virtual void ProcessInventoryNotification_Implementation(const FInventoryNotificationData& Notification) override;
 
 	// --- Class Functions ------------------------------
 protected:
 	bool IsAuthority() const;
+
+	/**
+	 * Checks if adding quantity of the template fits capacity limits.
+	 * @param Template Template of the item to add
+	 * @param QuantityDelta Quantity to add
+	 * @param SlotDelta Number of new slots the item would occupy
+	 * @return True if capacity allows the addition
+	 */
+	bool HasCapacityFor(const UMounteaInventoryItemTemplate* Template, const int32 QuantityDelta, const int32 SlotDelta) const;
+
+	/**
+	 * Checks if aggregated changes fit capacity limits. Only growing totals are validated.
+	 * @param WeightDelta Change in total weight
+	 * @param SlotDelta Change in occupied slots
+	 * @param CategoryDeltas Change in quantity per category
+	 * @return True if capacity allows the changes
+	 */
+	bool HasCapacityForDeltas(const double WeightDelta, const int32 SlotDelta, const TMap<FString, int32>& CategoryDeltas) const;
+
+	/** Applies quantity change of the template to running capacity totals. */
+	void UpdateCapacityTotals(const UMounteaInventoryItemTemplate* Template, const int32 QuantityDelta);
+
+	/** Rebuilds running capacity totals from inventory items. */
+	void RebuildCapacityTotals() const;
 	
 	UFUNCTION(Server, Reliable)
 	void AddItem_Server(const FMounteaInventoryItem& Item);
@@ -86,17 +127,36 @@ protected:
 	void ChangeItemQuantity_Server(const FGuid& ItemGuid, const int32 DeltaAmount);
 	UFUNCTION(Server, Reliable)
 	void ClearInventory_Server();
+	UFUNCTION(Server, Reliable)
+	void ExecuteTransaction_Server(const TArray<FInventoryTransactionOperation>& Operations);
 
 	UFUNCTION(Client, Unreliable)
 	void ProcessInventoryNotification_Client(const FGuid& TargetItem, const FString& NotifType, const int32 QuantityDelta);
-	UFUNCTION(Client, Unreliable)
-	void PostItemAdded_Client(const FMounteaInventoryItem& Item);
-	UFUNCTION(Client, Unreliable)
-	void PostItemRemoved_Client(const FMounteaInventoryItem& Item);
-	UFUNCTION(Client, Unreliable)
-	void PostItemQuantityChanged(const FMounteaInventoryItem& Item, const int32 OldQuantity, const int32 NewQuantity);
-	UFUNCTION(Client, Unreliable)
-	void PostItemDurabilityChanged(const FMounteaInventoryItem& Item, const int32 OldDurability, const int32 NewDurability);
+
+	/**
+	 * Compares client template registry checksum with server one.
+	 * Templates are replicated as registry indices on the connection only if both match.
+	 */
+	UFUNCTION(Server, Reliable)
+	void VerifyTemplateRegistry_Server(const int32 ClientChecksum);
+	UFUNCTION(Client, Reliable)
+	void ConfirmTemplateRegistry_Client();
+
+	/** Assigns template loaded after items referencing it were received and replays their add events. */
+	void OnTemplateLoaded(const int32 TemplateIndex, UMounteaInventoryItemTemplate* LoadedTemplate);
+
+	/**
+	 * Queues notification for the item change. Changes of the same item are merged and processed
+	 * once on the next tick. Remote clients derive their notifications from item replication instead.
+	 * @param Item Item state after the change
+	 * @param QuantityDelta Change in quantity
+	 * @param bAdded Whether the item was added to inventory
+	 * @param bRemoved Whether the item was removed from inventory
+	 */
+	void QueueItemNotification(const FMounteaInventoryItem& Item, const int32 QuantityDelta, const bool bAdded, const bool bRemoved);
+
+	/** Processes all queued notifications, one per changed item. */
+	void FlushItemNotifications();
 
 	// --- Events ------------------------------
 protected:
@@ -128,6 +188,28 @@ private:
 		meta=(AllowPrivateAccess),
 		meta=(DisplayPriority=2))
 	EInventoryFlags InventoryTypeFlag;
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Replicated, Category="Inventory",
+		meta=(AllowPrivateAccess),
+		meta=(DisplayPriority=3))
+	FInventoryCapacityLimits CapacityLimits;
+
+	/** Running total weight of all items, kept in sync on every mutation. */
+	mutable double CurrentWeight = 0.0;
+
+	/** Running total quantity per category, kept in sync on every mutation. */
+	mutable TMap<FString, int32> CategoryQuantities;
+
+	/** Set when running totals cannot be updated incrementally (replication, loading) and need rebuild. */
+	mutable bool bCapacityTotalsDirty = true;
+
+	/** Notifications merged per item until the next flush. */
+	TMap<FGuid, FInventoryPendingNotification> PendingNotifications;
+
+	/** Whether flush of pending notifications is already scheduled for the next tick. */
+	bool bNotificationFlushScheduled = false;
+
+	FDelegateHandle TemplateLoadedHandle;
 	
 protected:
 	
@@ -37,6 +37,17 @@ class MOUNTEAADVANCEDINVENTORYSYSTEM_API UMounteaAdvancedInventoryLoadoutItem :
 public:
 	
 	UMounteaAdvancedInventoryLoadoutItem();
+
+	/**
+	 * Resolves quantity granted by this entry.
+	 *
+	 * Random quantity is drawn from provided stream and clamped to Item Template's Max Quantity,
+	 * so the same stream seed always produces the same quantity.
+	 *
+	 * @param RandomStream Stream used when bUseRandomQuantity is enabled.
+	 * @return Quantity to grant.
+	 */
+	int32 ResolveQuantity(FRandomStream& RandomStream) const;
 	
 public:
 	
@@ -14,9 +14,12 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "UObject/Object.h"
+#include "Interfaces/Crafting/MounteaAdvancedCraftingParticipantInterface.h"
 #include "MounteaCraftingBaseDataTypes.generated.h"
 
 class UMounteaRecipeTemplate;
+class UMounteaRecipeIngredientsList;
+class UMounteaInventoryItemTemplate;
 
 /**
  * 
@@ -28,7 +31,8 @@ struct FMounteaCraftingResult
 	
 	FMounteaCraftingResult() 
 		: bCraftingSuccess(false),
-		ResultItemId(FGuid::NewGuid())
+		ResultItemId(FGuid::NewGuid()),
+		CraftedCount(0)
 	{};
 	
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
@@ -36,6 +40,78 @@ struct FMounteaCraftingResult
 	
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
 	FGuid ResultItemId;	
+
+	/** How many times the Recipe was crafted. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	int32 CraftedCount;
+};
+
+/**
+ * Craftability of a single Recipe resolved against participant's Inventory.
+ * Ingredient option which allows most crafts is reported, for non-craftable recipes
+ * the option missing the least ingredients is reported instead.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaRecipeCraftability
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	TObjectPtr<UMounteaRecipeTemplate> Recipe = nullptr;
+
+	/** How many times the Recipe can be crafted with current Inventory. MAX_int32 for Recipes without ingredients. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	int32 CraftableCount = 0;
+
+	/** Ingredient option the craftability is reported for. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	TObjectPtr<UMounteaRecipeIngredientsList> IngredientsList = nullptr;
+
+	/** Ingredient templates and quantities missing to craft the Recipe once. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	TMap<TObjectPtr<UMounteaInventoryItemTemplate>, int32> MissingIngredients;
+
+	bool IsCraftable() const { return CraftableCount > 0; }
+};
+
+/**
+ * Single timed crafting job queued on a Crafting Station.
+ * Only the first job in the queue is running, its units are crafted one after another,
+ * each unit taking Duration seconds. Clients interpolate progress from StartTime, nothing is replicated per tick.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaCraftingJob
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	FGuid JobGuid;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	TObjectPtr<UMounteaRecipeTemplate> Recipe = nullptr;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	TObjectPtr<UMounteaRecipeIngredientsList> Ingredients = nullptr;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	TScriptInterface<IMounteaAdvancedCraftingParticipantInterface> Participant;
+
+	/** Server world time the currently crafted unit started at. Negative while job is waiting in queue. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	double StartTime = -1.0;
+
+	/** Seconds needed to craft single unit. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	float Duration = 0.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	int32 Quantity = 1;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Crafting")
+	int32 CompletedQuantity = 0;
+
+	bool IsRunning() const { return StartTime >= 0.0; }
+	double GetUnitFinishTime() const { return StartTime + Duration; }
 };
 
 /**
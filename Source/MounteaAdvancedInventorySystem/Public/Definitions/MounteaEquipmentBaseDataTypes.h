@@ -15,6 +15,8 @@
 #include "Hash/Blake3.h"
 #include "GameplayTagContainer.h"
 #include "Definitions/MounteaEquipmentBaseEnums.h"
+#include "Definitions/MounteaInventoryItem.h"
+#include "Engine/StreamableManager.h"
 #include "Interfaces/Equipment/MounteaAdvancedEquipmentItemInterface.h"
 #include "MounteaEquipmentBaseDataTypes.generated.h"
 
@@ -69,6 +71,23 @@ struct FEquipmentTransitionContext
 	bool bNeedsSlotSwitch = false;
 };
 
+/**
+ * Equip request waiting for its SpawnActor class to finish streaming in.
+ */
+USTRUCT()
+struct FPendingEquipmentLoad
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	FMounteaInventoryItem ItemDefinition;
+
+	UPROPERTY(Transient)
+	FName TargetSlotId = NAME_None;
+
+	TSharedPtr<FStreamableHandle> LoadHandle;
+};
+
 /**
  * 
  */
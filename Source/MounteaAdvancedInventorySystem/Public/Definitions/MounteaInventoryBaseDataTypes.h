@@ -340,6 +340,9 @@ public:
 	 * * Value
 	 * * Weight
 	 * * Rarity
+	 * * Category
+	 * * Quantity
+	 * * Durability
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite,
 		meta=(DisplayPriority=1))
@@ -349,6 +352,62 @@ public:
 
 #pragma endregion
 
+#pragma region InventoryCapacity
+
+/**
+ * FInventoryCapacityLimits defines optional capacity constraints enforced by an inventory.
+ * Limits are checked against running totals maintained by the inventory, so capacity
+ * checks never need to iterate over inventory items.
+ *
+ * @see IMounteaAdvancedInventoryInterface
+ * @see UMounteaInventoryItemTemplate
+ */
+USTRUCT(BlueprintType)
+struct FInventoryCapacityLimits
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Whether total weight of items is limited. Only templates with weight are counted. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Weight",
+		meta=(DisplayPriority=0))
+	bool bLimitWeight = false;
+
+	/** Maximum total weight this inventory can hold */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Weight",
+		meta=(EditCondition="bLimitWeight"),
+		meta=(ClampMin=0.0, Units="kg"),
+		meta=(DisplayPriority=1))
+	float MaxWeight = 100.f;
+
+	/** Whether number of distinct item slots is limited. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Slots",
+		meta=(DisplayPriority=2))
+	bool bLimitSlots = false;
+
+	/** Maximum number of distinct items (stacks) this inventory can hold */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Slots",
+		meta=(EditCondition="bLimitSlots"),
+		meta=(ClampMin=0, UIMin=0),
+		meta=(DisplayPriority=3))
+	int32 MaxSlots = 20;
+
+	/** Whether total quantity of items per category is limited. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Categories",
+		meta=(DisplayPriority=4))
+	bool bLimitCategories = false;
+
+	/** Maximum total quantity per category. Categories which are not listed are not limited. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Categories",
+		meta=(EditCondition="bLimitCategories"),
+		meta=(ForceInlineRow),
+		meta=(DisplayPriority=5))
+	TMap<FString, int32> CategoryLimits;
+};
+
+#pragma endregion
+
 // Equality operator for FInventoryRarity
 FORCEINLINE bool operator==(const FInventoryRarity& LHS, const FInventoryRarity& RHS)
 {
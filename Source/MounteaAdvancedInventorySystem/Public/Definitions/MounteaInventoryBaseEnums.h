@@ -80,6 +80,17 @@ enum class EInventoryTypeFlags : uint8
 };
 ENUM_CLASS_FLAGS(EInventoryTypeFlags)
 
+/** Enum defining the kind of mutation carried by a single inventory transaction operation */
+UENUM(BlueprintType)
+enum class EInventoryTransactionOperationType : uint8
+{
+	EITOT_Add UMETA(DisplayName = "Add", Tooltip = "Adds the item to the inventory, stacking it onto an existing item if possible."),
+	EITOT_Remove UMETA(DisplayName = "Remove", Tooltip = "Removes quantity of the item, removing the item completely once it reaches zero."),
+	EITOT_ChangeQuantity UMETA(DisplayName = "Change Quantity", Tooltip = "Changes quantity of an existing item by a signed delta."),
+
+	Default UMETA(Hidden)
+};
+
 /** Enum for defining how inventory items should be sorted */
 UENUM(BlueprintType)
 enum class EInventorySortType : uint8
@@ -15,6 +15,7 @@
 #include "GameplayTagContainer.h"
 #include "Net/Serialization/FastArraySerializer.h"
 #include "UObject/Object.h"
+#include "UObject/ObjectKey.h"
 #include "MounteaInventoryItem.generated.h"
 
 class IMounteaAdvancedInventoryInterface;
@@ -242,6 +243,19 @@ public:
 	 */
 	bool SetOwningInventory(const TScriptInterface<IMounteaAdvancedInventoryInterface>& InOwningInventory);
 
+	/**
+	 * @return True if item was received before its template finished loading
+	 */
+	bool IsTemplatePending() const { return PendingTemplateIndex != INDEX_NONE; }
+
+	/**
+	 * Assigns template which finished loading after the item was received.
+	 * @param TemplateIndex Registry index of the loaded template
+	 * @param InTemplate The loaded template
+	 * @return True if item was waiting for this template
+	 */
+	bool ResolvePendingTemplate(const int32 TemplateIndex, UMounteaInventoryItemTemplate* InTemplate);
+
 	/*************************************************************/
 	/******************** OPERATORS *************************/
 	/*************************************************************/
@@ -326,6 +340,15 @@ private:
 		PreReplicationSnapshot = FInventoryItemSnapshot(*this);
 	}
 
+	/** Registry index of the template which is still being loaded, never replicated nor saved */
+	int32 PendingTemplateIndex = INDEX_NONE;
+
+	/** Set by FInventoryItemArray only while it delta serializes this item, never replicated nor saved */
+	bool bNetSerializingInArray = false;
+
+	friend struct FInventoryItemArray;
+	friend struct FScopedInventoryItemArraySerialization;
+
 
 	/*************************************************************/
 	/******************* SERIALIZATION************************/
@@ -341,6 +364,29 @@ public:
 	//void PostReplicatedReceive(const FInventoryItemArray::FPostReplicatedReceiveParameters& Parameters) {};
 };
 
+/**
+ * Makes Item serialize as an element of the replicated Inventory array for the scope lifetime,
+ * allowing registry template indices. Lets tools and tests reproduce array serialization of a single item.
+ *
+ * @see FInventoryItemArray::NetDeltaSerialize
+ */
+struct FScopedInventoryItemArraySerialization
+{
+	explicit FScopedInventoryItemArraySerialization(FMounteaInventoryItem& InItem)
+		: Item(InItem)
+	{
+		Item.bNetSerializingInArray = true;
+	}
+
+	~FScopedInventoryItemArraySerialization()
+	{
+		Item.bNetSerializingInArray = false;
+	}
+
+private:
+	FMounteaInventoryItem& Item;
+};
+
 /**
  * FInventoryItemArray is a replicated container for inventory item collections.
  * Provides efficient delta serialization for inventory item arrays using Unreal's FastArraySerializer
@@ -358,10 +404,90 @@ struct FInventoryItemArray : public FFastArraySerializer
 		meta=(DisplayPriority=0))
 	TArray<FMounteaInventoryItem> Items;
 
-	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
-	{
-		return FastArrayDeltaSerialize<FMounteaInventoryItem>(Items, DeltaParams, *this);
-	}
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams);
+
+	/**
+	 * Sets the inventory owning this array. Replicated items do not carry their owner,
+	 * it is assigned from the array when they arrive.
+	 * @param InOwningInventory Inventory owning this array
+	 */
+	void SetOwningInventory(const TScriptInterface<IMounteaAdvancedInventoryInterface>& InOwningInventory);
+
+	/**
+	 * @return Inventory owning this array. Could be null!
+	 */
+	TScriptInterface<IMounteaAdvancedInventoryInterface> GetOwningInventory() const;
+
+	/*************************************************************/
+	/************************ LOOKUPS ************************/
+	/*************************************************************/
+
+public:
+
+	/**
+	 * Appends the item to Items and registers it in the lookup indices.
+	 * @param Item The item to append
+	 * @return Index of the newly added item
+	 */
+	int32 AddIndexedItem(const FMounteaInventoryItem& Item);
+
+	/**
+	 * Removes the item at the given index. Lookup indices are updated in place,
+	 * removed index is dropped and every following index is shifted down by one.
+	 * @param Index Index of the item to remove
+	 */
+	void RemoveIndexedItemAt(const int32 Index);
+
+	/** Removes all items and resets the lookup indices. */
+	void ResetIndexedItems();
+
+	/** Forces the lookup indices to be rebuilt on the next query. */
+	void MarkLookupsDirty() const { bLookupsDirty = true; }
+
+	/**
+	 * @param ItemGuid GUID of the item instance
+	 * @return Index of the item in Items, INDEX_NONE if not found
+	 */
+	int32 FindIndexByGuid(const FGuid& ItemGuid) const;
+
+	/**
+	 * @param Template Template to look up
+	 * @return Ascending indices of all items created from the template
+	 */
+	const TArray<int32>& FindIndicesByTemplate(const UMounteaInventoryItemTemplate* Template) const;
+
+	/**
+	 * @param CategoryId Category key as defined in Template->ItemCategory
+	 * @return Ascending indices of all items within the category
+	 */
+	const TArray<int32>& FindIndicesByCategory(const FString& CategoryId) const;
+
+	/**
+	 * @param RarityId Rarity key as defined in Template->ItemRarity
+	 * @return Ascending indices of all items with the rarity
+	 */
+	const TArray<int32>& FindIndicesByRarity(const FString& RarityId) const;
+
+	// FFastArraySerializer contract, keeps lookups in sync on clients
+	void PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize);
+	void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize);
+
+private:
+
+	void RegisterLookup(const int32 Index) const;
+	void UnregisterLookup(const int32 Index) const;
+	void RebuildLookupsIfDirty() const;
+
+	// Transient lookup indices, never replicated nor saved
+	mutable TMap<FGuid, int32> GuidLookup;
+	mutable TMap<TObjectKey<UMounteaInventoryItemTemplate>, TArray<int32>> TemplateLookup;
+	mutable TMap<FString, TArray<int32>> CategoryLookup;
+	mutable TMap<FString, TArray<int32>> RarityLookup;
+	mutable int32 LookupsItemCount = 0;
+	mutable bool bLookupsDirty = true;
+
+	// Owner assigned to replicated items, never replicated nor saved
+	TWeakObjectPtr<UObject> OwningInventoryObject;
 };
 
 template<>
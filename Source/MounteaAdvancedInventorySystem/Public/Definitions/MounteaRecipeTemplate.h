@@ -19,6 +19,39 @@
 class UMounteaRecipeIngredientsList;
 class UMounteaInventoryItemTemplate;
 class UMounteaInventoryItemTemplate_Recipe;
+class UTexture2D;
+
+/**
+ * Data of Recipe's result item, resolved in editor whenever Recipe is saved or cooked.
+ * Allows filtering and displaying recipes without loading their result items.
+ */
+USTRUCT(BlueprintType)
+struct FMounteaRecipeResultMetadata
+{
+	GENERATED_BODY()
+
+	/** Result item this metadata was resolved from. Metadata is considered stale if it differs from Recipe's ResultItem. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Metadata")
+	FSoftObjectPath ResultItemPath;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Metadata")
+	FText DisplayName;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Metadata")
+	FString ItemCategory;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Metadata")
+	FString ItemSubCategory;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Metadata")
+	FString ItemRarity;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Metadata")
+	FGameplayTagContainer Tags;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Metadata")
+	TSoftObjectPtr<UTexture2D> ItemThumbnail;
+};
 
 /**
  * 
@@ -62,7 +95,7 @@ public:
 		meta=(FullyExpand=true))
 	TArray<TObjectPtr<UMounteaRecipeIngredientsList>> RecipeIngredientOptions;
 	
-	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category = "Configuration",
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, AssetRegistrySearchable, Category = "Configuration",
 		meta=(NoResetToDefault))
 	FGuid RecipeGuid;
 
@@ -75,7 +108,25 @@ public:
 		meta=(NoResetToDefault))
 	TSoftObjectPtr<UMounteaInventoryItemTemplate_Recipe> RecipeSource;
 
+	/** Result item data resolved on save, so recipes can be filtered without loading ResultItem. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Technical Data", AdvancedDisplay,
+		meta=(NoResetToDefault))
+	FMounteaRecipeResultMetadata ResultMetadata;
+
+public:
+
+	/** @return True if ResultMetadata was resolved from current ResultItem. */
+	bool HasValidResultMetadata() const
+	{
+		return !ResultItem.IsNull() && ResultMetadata.ResultItemPath == ResultItem.ToSoftObjectPath();
+	}
+
 #if WITH_EDITOR
+	/** Resolves ResultMetadata from ResultItem, loading it if needed. */
+	void RefreshResultMetadata();
+
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 	virtual void PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent) override;
 #endif
 };
@@ -0,0 +1,71 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not 
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMounteaInventoryItem;
+struct FInventorySortCriteria;
+
+/**
+ * FMounteaInventoryItemSortSpec is resolved form of Inventory Sort Criteria.
+ * Criteria keys are parsed once and ordered from primary to least significant key.
+ *
+ * @see FInventorySortCriteria
+ * @see FMounteaInventoryItemSortKey
+ */
+struct MOUNTEAADVANCEDINVENTORYSYSTEM_API FMounteaInventoryItemSortSpec
+{
+	enum class ESortKey : uint8 { Name, Value, Weight, Rarity, Category, Quantity, Durability, Unknown };
+
+	/**
+	 * Criteria are applied as if sorted one after another by priority, so the lowest priority criteria is the primary key.
+	 * @param SortingCriteria Criteria to resolve
+	 * @return Resolved sort spec
+	 */
+	static FMounteaInventoryItemSortSpec Make(const TArray<FInventorySortCriteria>& SortingCriteria);
+
+	bool IsEmpty() const { return SortKeys.Num() == 0; }
+	bool UsesKey(const ESortKey SortKey) const { return (UsedKeysMask & (1 << static_cast<uint8>(SortKey))) != 0; }
+
+	TArray<ESortKey, TInlineAllocator<8>> SortKeys;
+	uint8 UsedKeysMask = 0;
+};
+
+/**
+ * FMounteaInventoryItemSortKey holds precomputed sort values of a single Inventory Item.
+ * Keys are resolved once per Item, so comparisons never touch settings or localized text.
+ *
+ * @see FMounteaInventoryItemSortSpec
+ */
+struct MOUNTEAADVANCEDINVENTORYSYSTEM_API FMounteaInventoryItemSortKey
+{
+	/**
+	 * @param Item Item to resolve keys for
+	 * @param SortSpec Spec defining which keys are needed
+	 * @return Resolved sort key
+	 */
+	static FMounteaInventoryItemSortKey Make(const FMounteaInventoryItem& Item, const FMounteaInventoryItemSortSpec& SortSpec);
+
+	/**
+	 * @return Negative if A goes before B, positive if B goes before A, 0 if keys are equal
+	 */
+	static int32 Compare(const FMounteaInventoryItemSortSpec& SortSpec, const FMounteaInventoryItemSortKey& A, const FMounteaInventoryItemSortKey& B);
+
+	FString Name;
+	float Value = 0.f;
+	float Weight = 0.f;
+	float Durability = 0.f;
+	int32 Quantity = 0;
+	int32 RarityPriority = 0;
+	int32 CategoryOrdinal = INDEX_NONE;
+};
@@ -0,0 +1,138 @@
+﻿// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not 
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Definitions/MounteaInventoryBaseDataTypes.h"
+#include "Definitions/MounteaInventoryItem.h"
+#include "Helpers/MounteaInventoryItemSortKey.h"
+#include "Interfaces/Inventory/MounteaAdvancedInventoryInterface.h"
+#include "MounteaInventoryItemsView.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnInventoryItemsViewUpdated, const FGuid&, ItemGuid, int32, OldIndex, int32, NewIndex);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInventoryItemsViewRebuilt);
+
+/**
+ * UMounteaInventoryItemsView is a filtered and sorted list of Items bound to an Inventory.
+ * View listens to Inventory events and keeps its Items ordered incrementally, so single Item changes
+ * only move that Item instead of searching and sorting the whole Inventory again.
+ *
+ * Filter follows the same rules as FindItems and order follows the same rules as SortInventoryItems.
+ *
+ * @see IMounteaAdvancedInventoryInterface::FindItems
+ * @see UMounteaInventoryStatics::SortInventoryItems
+ */
+UCLASS(BlueprintType)
+class MOUNTEAADVANCEDINVENTORYSYSTEM_API UMounteaInventoryItemsView : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Binds View to Inventory and rebuilds Items. Previously bound Inventory is unbound.
+	 * @param InInventory Inventory to observe
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Inventory|View")
+	void BindInventory(const TScriptInterface<IMounteaAdvancedInventoryInterface>& InInventory);
+
+	/** Stops observing bound Inventory and clears Items. */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Inventory|View")
+	void UnbindInventory();
+
+	/**
+	 * Sets filter and rebuilds Items.
+	 * @param InSearchParams Search params Items must match
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Inventory|View")
+	void SetSearchParams(const FInventoryItemSearchParams& InSearchParams);
+
+	/**
+	 * Sets sorting and rebuilds Items.
+	 * @param InSortingCriteria Criteria Items are sorted by
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Inventory|View")
+	void SetSortingCriteria(const TArray<FInventorySortCriteria>& InSortingCriteria);
+
+	/** Searches and sorts bound Inventory from scratch. */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Inventory|View")
+	void RebuildView();
+
+	/**
+	 * @return Filtered and sorted Items
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Inventory|View")
+	TArray<FMounteaInventoryItem> GetItems() const { return Items; };
+
+	/**
+	 * @param ItemGuid Guid of Item to find
+	 * @return Index of Item in View, INDEX_NONE if Item is not in View
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Inventory|View")
+	int32 GetItemIndex(const FGuid& ItemGuid) const;
+
+	/**
+	 * @return Inventory this View is bound to
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Inventory|View")
+	TScriptInterface<IMounteaAdvancedInventoryInterface> GetInventory() const { return Inventory; };
+
+	/**
+	 * Called when single Item is added, moved, modified or removed.
+	 * OldIndex is INDEX_NONE for added Items, NewIndex is INDEX_NONE for removed Items.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="Mountea|Inventory & Equipment|Inventory|View")
+	FOnInventoryItemsViewUpdated OnItemsViewUpdated;
+
+	/** Called when Items are rebuilt from scratch. */
+	UPROPERTY(BlueprintAssignable, Category="Mountea|Inventory & Equipment|Inventory|View")
+	FOnInventoryItemsViewRebuilt OnItemsViewRebuilt;
+
+protected:
+
+	virtual void BeginDestroy() override;
+
+	UFUNCTION()
+	void ProcessItemAdded(const FMounteaInventoryItem& AddedItem);
+	UFUNCTION()
+	void ProcessItemRemoved(const FMounteaInventoryItem& RemovedItem);
+	UFUNCTION()
+	void ProcessItemQuantityChanged(const FMounteaInventoryItem& Item, int32 OldQuantity, int32 NewQuantity);
+	UFUNCTION()
+	void ProcessItemDurabilityChanged(const FMounteaInventoryItem& Item, float OldDurability, float NewDurability);
+
+private:
+
+	void UpdateItem(const FMounteaInventoryItem& Item);
+	void RemoveItemAt(const int32 ItemIndex);
+	int32 FindInsertIndex(const FMounteaInventoryItemSortKey& SortKey) const;
+
+protected:
+
+	UPROPERTY(BlueprintReadOnly, Category="View")
+	TScriptInterface<IMounteaAdvancedInventoryInterface> Inventory;
+
+	UPROPERTY(BlueprintReadOnly, Category="View")
+	FInventoryItemSearchParams SearchParams;
+
+	UPROPERTY(BlueprintReadOnly, Category="View")
+	TArray<FInventorySortCriteria> SortingCriteria;
+
+	UPROPERTY(Transient)
+	TArray<FMounteaInventoryItem> Items;
+
+private:
+
+	FMounteaInventoryItemSortSpec SortSpec;
+	TArray<FMounteaInventoryItemSortKey> SortKeys;
+};
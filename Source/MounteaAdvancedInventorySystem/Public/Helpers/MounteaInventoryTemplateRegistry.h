@@ -0,0 +1,94 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not 
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UMounteaInventoryItemTemplate;
+class UNetConnection;
+class UPackageMap;
+struct FStreamableHandle;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnMounteaTemplateRegistryTemplateLoaded, const int32 /*TemplateIndex*/, UMounteaInventoryItemTemplate* /*Template*/);
+
+/**
+ * FMounteaInventoryTemplateRegistry assigns compact, deterministic indices to Item Template assets.
+ * Indices are derived from the Asset Registry sorted by object path, so server and clients running
+ * the same build resolve the same index to the same template. Used by network serialization
+ * to replace full object references with a small integer.
+ *
+ * Indices are only used on connections which confirmed matching registry checksum,
+ * other connections keep receiving full object references.
+ *
+ * Templates which are not saved assets (runtime created, transient) have no index.
+ *
+ * @see FMounteaInventoryItem::NetSerialize
+ */
+class MOUNTEAADVANCEDINVENTORYSYSTEM_API FMounteaInventoryTemplateRegistry
+{
+public:
+
+	/**
+	 * @param Template Template to look up
+	 * @return Registry index of the template, INDEX_NONE if template is not a registered asset
+	 */
+	static int32 GetTemplateIndex(const UMounteaInventoryItemTemplate* Template);
+
+	/**
+	 * Resolves the template if it is in memory. Otherwise the template is loaded asynchronously
+	 * and OnTemplateLoaded is broadcast once it is ready.
+	 * @param Index Registry index received from network
+	 * @param bOutPending Set when template is being loaded
+	 * @return Registered template, nullptr for unknown or not yet loaded index
+	 */
+	static UMounteaInventoryItemTemplate* GetTemplateByIndex(const int32 Index, bool& bOutPending);
+
+	/** Broadcast when template requested by GetTemplateByIndex finished loading. */
+	static FOnMounteaTemplateRegistryTemplateLoaded& OnTemplateLoaded();
+
+	/** @return Checksum of registered template paths, equal on machines with the same registry. */
+	static uint32 GetChecksum();
+
+	/**
+	 * Marks connection whose remote end confirmed matching checksum, indices are used for it from now on.
+	 * @param Connection Verified connection
+	 */
+	static void SetConnectionVerified(UNetConnection* Connection);
+
+	/**
+	 * @param Map Package map of the serialized connection, null for local serialization
+	 * @return True if templates can be sent as registry indices
+	 */
+	static bool CanUseIndices(UPackageMap* Map);
+
+	/** Drops registry data, registry is rebuilt on next access. */
+	static void Invalidate();
+
+private:
+
+	static FMounteaInventoryTemplateRegistry& Get();
+
+	void BuildIfNeeded();
+	void LogUnknownIndex(const int32 Index);
+
+	TArray<FSoftObjectPath> TemplatePaths;
+	TMap<FSoftObjectPath, int32> TemplateIndices;
+	TMap<int32, TSharedPtr<FStreamableHandle>> PendingLoads;
+	TSet<TObjectKey<UNetConnection>> VerifiedConnections;
+	FOnMounteaTemplateRegistryTemplateLoaded TemplateLoadedEvent;
+	uint32 Checksum = 0;
+	double LastUnknownIndexLogTime = 0.0;
+	int32 SuppressedUnknownIndexLogs = 0;
+	bool bIsBuilt = false;
+	bool bIsBound = false;
+};
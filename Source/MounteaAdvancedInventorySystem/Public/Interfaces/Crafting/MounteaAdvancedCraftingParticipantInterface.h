@@ -19,6 +19,7 @@ class IMounteaAdvancedCraftingStationInterface;
 class IMounteaAdvancedInventoryInterface;
 struct FGameplayTag;
 struct FMounteaCraftingResult;
+struct FMounteaRecipeCraftability;
 
 class UMounteaRecipeTemplate;
 class UMounteaRecipeIngredientsList;
@@ -72,10 +73,18 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Crafting")
 	bool IsCraftingPossible(UMounteaRecipeTemplate* TemplateToCraft) const;
 	virtual bool IsCraftingPossible_Implementation(UMounteaRecipeTemplate* TemplateToCraft) const = 0;
+
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Crafting")
+	FMounteaRecipeCraftability GetRecipeCraftability(UMounteaRecipeTemplate* RecipeTemplate) const;
+	virtual FMounteaRecipeCraftability GetRecipeCraftability_Implementation(UMounteaRecipeTemplate* RecipeTemplate) const = 0;
 	
 	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Crafting")
 	FMounteaCraftingResult StartCrafting(UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients);
 	virtual FMounteaCraftingResult StartCrafting_Implementation(UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients) = 0;
+
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Crafting")
+	FMounteaCraftingResult StartCraftingMultiple(UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients, const int32 CraftCount);
+	virtual FMounteaCraftingResult StartCraftingMultiple_Implementation(UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients, const int32 CraftCount) = 0;
 	
 	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Crafting")
 	TScriptInterface<IMounteaAdvancedInventoryInterface> GetParentInventory() const;
@@ -17,6 +17,9 @@
 #include "MounteaAdvancedCraftingStationInterface.generated.h"
 
 class IMounteaAdvancedCraftingParticipantInterface;
+class UMounteaRecipeTemplate;
+class UMounteaRecipeIngredientsList;
+struct FMounteaCraftingJob;
 enum class ECraftingStationState : uint8;
 
 UINTERFACE(MinimalAPI, BlueprintType, Blueprintable)
@@ -65,6 +68,22 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Crafting")
 	bool SetCraftingStationState(const ECraftingStationState NewCraftingStationState);
 	virtual bool SetCraftingStationState_Implementation(const ECraftingStationState NewCraftingStationState) = 0;
+
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Crafting")
+	FGuid EnqueueCraftingJob(const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant, UMounteaRecipeTemplate* Recipe, UMounteaRecipeIngredientsList* Ingredients, const int32 Quantity);
+	virtual FGuid EnqueueCraftingJob_Implementation(const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant, UMounteaRecipeTemplate* Recipe, UMounteaRecipeIngredientsList* Ingredients, const int32 Quantity) = 0;
+
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Crafting")
+	bool CancelCraftingJob(const FGuid& JobGuid);
+	virtual bool CancelCraftingJob_Implementation(const FGuid& JobGuid) = 0;
+
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Crafting")
+	TArray<FMounteaCraftingJob> GetCraftingJobs() const;
+	virtual TArray<FMounteaCraftingJob> GetCraftingJobs_Implementation() const = 0;
+
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Crafting")
+	float GetCraftingJobProgress(const FGuid& JobGuid) const;
+	virtual float GetCraftingJobProgress_Implementation(const FGuid& JobGuid) const = 0;
 	
 	
 };
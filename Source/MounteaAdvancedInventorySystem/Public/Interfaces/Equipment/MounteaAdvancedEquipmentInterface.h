@@ -49,6 +49,7 @@ public:
 	
 	/**
 	 * Equips the specified inventory item using the equipment system's internal slot resolution.
+	 * If the item's Spawn Actor class is not loaded yet, equip completes asynchronously once it is and nullptr is returned.
 	 *
 	 * @param ItemDefinition The inventory item definition to equip.
 	 * @return Spawned equipment actor if equipping succeeds, otherwise nullptr.
@@ -59,6 +60,7 @@ public:
 	
 	/**
 	 * Equips the specified inventory item into a designated equipment slot.
+	 * If the item's Spawn Actor class is not loaded yet, equip completes asynchronously once it is and nullptr is returned.
 	 *
 	 * @param SlotId Name of the equipment slot where the item should be equipped.
 	 * @param ItemDefinition The inventory item definition to equip.
@@ -0,0 +1,47 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "MounteaAdvancedPooledActorInterface.generated.h"
+
+UINTERFACE(MinimalAPI, Blueprintable, BlueprintType)
+class UMounteaAdvancedPooledActorInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Implemented by equipment actors, or any of their components, that keep per-item state.
+ * Reused actors skip BeginPlay and construction script, so the pool notifies them instead.
+ *
+ * @see UMounteaEquipmentActorPoolSubsystem
+ */
+class MOUNTEAADVANCEDINVENTORYSYSTEM_API IMounteaAdvancedPooledActorInterface
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Called when pooled actor is handed out again, after owner, visibility and collision were restored. */
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Equipment|Pool")
+	void OnAcquiredFromPool();
+	virtual void OnAcquiredFromPool_Implementation()
+	{ }
+
+	/** Called before actor is returned into the pool. Reset any per-item state here. */
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Equipment|Pool")
+	void OnReleasedToPool();
+	virtual void OnReleasedToPool_Implementation()
+	{ }
+};
@@ -13,6 +13,8 @@
 
 #include "CoreMinimal.h"
 #include "Definitions/MounteaAdvancedInventoryNotification.h"
+#include "Definitions/MounteaInventoryBaseDataTypes.h"
+#include "Definitions/MounteaInventoryBaseEnums.h"
 #include "Definitions/MounteaInventoryItem.h"
 #include "UObject/Interface.h"
 #include "MounteaAdvancedInventoryInterface.generated.h"
@@ -120,6 +122,85 @@ struct FInventoryItemSearchParams
 	FString RarityId;
 };
 
+/**
+ * FInventoryTransactionOperation defines a single mutation executed as part of an inventory transaction.
+ * Operations are validated together and applied atomically, so either every operation succeeds
+ * or the inventory is left untouched.
+ *
+ * Add operations add a copy of Item, the inventory the item originates from is not modified.
+ * Remove operations target either ItemGuid or Template (all matching stacks are consumed) and remove
+ * the whole item when Amount is 0. Change Quantity operations apply Amount as signed delta to ItemGuid.
+ *
+ * @see IMounteaAdvancedInventoryInterface::ExecuteTransaction
+ * @see EInventoryTransactionOperationType
+ */
+USTRUCT(BlueprintType)
+struct FInventoryTransactionOperation
+{
+	GENERATED_BODY()
+
+	FInventoryTransactionOperation()
+		: OperationType(EInventoryTransactionOperationType::Default)
+		, Template(nullptr)
+		, Amount(0)
+	{}
+
+	static FInventoryTransactionOperation MakeAdd(const FMounteaInventoryItem& InItem)
+	{
+		FInventoryTransactionOperation returnValue;
+		returnValue.OperationType = EInventoryTransactionOperationType::EITOT_Add;
+		returnValue.Item = InItem;
+		return returnValue;
+	}
+
+	static FInventoryTransactionOperation MakeRemove(const FGuid& InItemGuid, const int32 InAmount = 0)
+	{
+		FInventoryTransactionOperation returnValue;
+		returnValue.OperationType = EInventoryTransactionOperationType::EITOT_Remove;
+		returnValue.ItemGuid = InItemGuid;
+		returnValue.Amount = InAmount;
+		return returnValue;
+	}
+
+	static FInventoryTransactionOperation MakeRemove(UMounteaInventoryItemTemplate* const InTemplate, const int32 InAmount)
+	{
+		FInventoryTransactionOperation returnValue;
+		returnValue.OperationType = EInventoryTransactionOperationType::EITOT_Remove;
+		returnValue.Template = InTemplate;
+		returnValue.Amount = InAmount;
+		return returnValue;
+	}
+
+	static FInventoryTransactionOperation MakeQuantityChange(const FGuid& InItemGuid, const int32 InDeltaAmount)
+	{
+		FInventoryTransactionOperation returnValue;
+		returnValue.OperationType = EInventoryTransactionOperationType::EITOT_ChangeQuantity;
+		returnValue.ItemGuid = InItemGuid;
+		returnValue.Amount = InDeltaAmount;
+		return returnValue;
+	}
+
+	/** Kind of mutation to perform. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Transaction")
+	EInventoryTransactionOperationType OperationType;
+
+	/** Item to add. Used by Add operations only. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Transaction")
+	FMounteaInventoryItem Item;
+
+	/** Target item. Used by Remove and Change Quantity operations. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Transaction")
+	FGuid ItemGuid;
+
+	/** Target template. Used by Remove operations when ItemGuid is not valid. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Transaction")
+	TObjectPtr<UMounteaInventoryItemTemplate> Template;
+
+	/** Quantity to remove (Remove) or signed quantity delta (Change Quantity). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Transaction")
+	int32 Amount;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnItemAdded, const FMounteaInventoryItem&, AddedItem);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnItemRemoved, const FMounteaInventoryItem&, RemovedItem);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnItemQuantityChanged, const FMounteaInventoryItem&, Item, int32, OldQuantity, int32, NewQuantity);
@@ -277,6 +358,17 @@ public:
 	bool HasItem(const FInventoryItemSearchParams& SearchParams) const;
 	virtual bool HasItem_Implementation(const FInventoryItemSearchParams& SearchParams) const = 0;
 
+	/**
+	* Executes multiple inventory mutations as a single atomic transaction.
+	* All operations are validated first and applied only if every one of them succeeds.
+	* Added items owned by another inventory are moved, added quantity is removed from that inventory.
+	* @param Operations Operations to apply, in order
+	* @return True if the transaction was applied (or sent to server)
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Inventory|Management")
+	bool ExecuteTransaction(const TArray<FInventoryTransactionOperation>& Operations);
+	virtual bool ExecuteTransaction_Implementation(const TArray<FInventoryTransactionOperation>& Operations) = 0;
+
 	// --- Item Stack Management ------------------------------
 
 	/**
@@ -312,6 +404,49 @@ public:
 	virtual bool ModifyItemDurability_Implementation(const FGuid& ItemGuid, float DeltaDurability) = 0;
 
 	
+	// --- Capacity Management ------------------------------
+
+	/**
+	* Gets capacity limits enforced by this inventory
+	* @return Capacity limits
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Inventory|Capacity")
+	FInventoryCapacityLimits GetCapacityLimits() const;
+	virtual FInventoryCapacityLimits GetCapacityLimits_Implementation() const = 0;
+
+	/**
+	* Sets capacity limits enforced by this inventory. Items already stored are not removed.
+	* @param NewLimits New capacity limits
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Inventory|Capacity")
+	void SetCapacityLimits(const FInventoryCapacityLimits& NewLimits);
+	virtual void SetCapacityLimits_Implementation(const FInventoryCapacityLimits& NewLimits) = 0;
+
+	/**
+	* Gets total weight of all items in inventory
+	* @return Current weight
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Inventory|Capacity")
+	float GetCurrentWeight() const;
+	virtual float GetCurrentWeight_Implementation() const = 0;
+
+	/**
+	* Gets number of occupied item slots
+	* @return Number of distinct items in inventory
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Inventory|Capacity")
+	int32 GetOccupiedSlots() const;
+	virtual int32 GetOccupiedSlots_Implementation() const = 0;
+
+	/**
+	* Gets total quantity of items in category
+	* @param CategoryId Category to check
+	* @return Total quantity of items in category
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Inventory|Capacity")
+	int32 GetCategoryQuantity(const FString& CategoryId) const;
+	virtual int32 GetCategoryQuantity_Implementation(const FString& CategoryId) const = 0;
+
 	// --- Notification Management ------------------------------
 
 	/**
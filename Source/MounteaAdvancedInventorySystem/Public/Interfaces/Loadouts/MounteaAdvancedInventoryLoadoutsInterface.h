@@ -35,12 +35,26 @@ public:
 	 *
 	 * Adds configured loadout items to inventory and attempts auto-equip for eligible entries.
 	 * On non-authority instances this routes execution to server RPC.
+	 * Loadout assets which are not loaded yet are streamed in first and the loadout is applied once they are.
 	 *
 	 * @return True if processing was started/completed, otherwise false.
 	 */
 	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Loadouts")
 	bool LoadLoadout();
 	virtual bool LoadLoadout_Implementation() = 0;
+
+	/**
+	 * Executes loadout processing with random quantities drawn from stream initialized by given seed.
+	 *
+	 * All quantities are resolved up front in loadout order, so the same seed and loadout always grant the same items.
+	 * Seed is only accepted on authority, clients request regular load and the server picks the seed.
+	 *
+	 * @param RandomSeed Seed of the random stream used for random quantities.
+	 * @return True if processing was started/completed, otherwise false.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category="Mountea|Inventory & Equipment|Loadouts")
+	bool LoadLoadoutWithSeed(const int32 RandomSeed);
+	virtual bool LoadLoadoutWithSeed_Implementation(const int32 RandomSeed) = 0;
 	
 	/**
 	 * Returns the currently configured loadout asset.
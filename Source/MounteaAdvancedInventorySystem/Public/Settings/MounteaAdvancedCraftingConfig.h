@@ -31,4 +31,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Crafting",
 		meta=(NoResetToDefault))
 	TSet<TSoftObjectPtr<UMounteaRecipeTemplate>> AllowedRecipes;
+
+#if WITH_EDITOR
+protected:
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
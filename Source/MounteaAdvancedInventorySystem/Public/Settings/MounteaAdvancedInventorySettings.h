@@ -61,6 +61,8 @@ public:
 	{
 		return "Project";
 	}
+
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
 
 public:
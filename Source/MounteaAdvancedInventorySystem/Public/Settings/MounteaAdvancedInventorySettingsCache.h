@@ -0,0 +1,153 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not 
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Definitions/MounteaAdvancedInventoryNotification.h"
+#include "Definitions/MounteaInventoryBaseDataTypes.h"
+#include "UObject/GCObject.h"
+
+struct FStreamableHandle;
+
+class UMounteaAdvancedInventorySettingsConfig;
+class UMounteaRecipeTemplate;
+
+/**
+ * FMounteaAdvancedInventorySettingsCache provides load-once access to the Inventory Settings Config for runtime hot paths.
+ * The config is resolved once and categories and rarities are kept as read-only views, pre-sorted by priority.
+ * Recipes allowed by the Crafting Config are indexed by their Guid, built separately on first recipe access.
+ * Recipe Guids are read from asset registry tags, recipes are never loaded just to be indexed.
+ * The config asset is kept referenced by the cache. Cache is invalidated whenever settings or the config asset are edited.
+ *
+ * @see UMounteaAdvancedInventorySettings
+ * @see UMounteaAdvancedInventorySettingsConfig
+ */
+class MOUNTEAADVANCEDINVENTORYSYSTEM_API FMounteaAdvancedInventorySettingsCache : public FGCObject
+{
+public:
+
+	/**
+	 * @return Inventory Settings Config, loaded on first access. Could be null!
+	 */
+	static UMounteaAdvancedInventorySettingsConfig* GetInventoryConfig();
+
+	/**
+	 * @return Allowed categories sorted by priority (highest first). Contains fallback category if no config is set.
+	 */
+	static const TMap<FString, FInventoryCategory>& GetSortedCategories();
+
+	/**
+	 * @return Allowed rarities sorted by priority (highest first). Contains fallback rarity if no config is set.
+	 */
+	static const TMap<FString, FInventoryRarity>& GetSortedRarities();
+
+	/**
+	 * @param CategoryId Category key
+	 * @return Category data, nullptr if category is not allowed
+	 */
+	static const FInventoryCategory* FindCategory(const FString& CategoryId);
+
+	/**
+	 * @param RarityId Rarity key
+	 * @return Rarity data, nullptr if rarity is not allowed
+	 */
+	static const FInventoryRarity* FindRarity(const FString& RarityId);
+
+	/**
+	 * @param RarityId Rarity key
+	 * @return Position of rarity in sorted rarities, INDEX_NONE if rarity is not allowed
+	 */
+	static int32 GetRarityOrdinal(const FString& RarityId);
+
+	/**
+	 * @param CategoryId Category key
+	 * @return Position of category in sorted categories, INDEX_NONE if category is not allowed
+	 */
+	static int32 GetCategoryOrdinal(const FString& CategoryId);
+
+	/**
+	 * @return Tags of allowed categories sorted by name. Sub-category tags are not included.
+	 */
+	static const TArray<FGameplayTag>& GetSortedCategoryTags();
+
+	/**
+	 * @param CategoryTag Tag to search for
+	 * @return True if tag is used by any allowed category or sub-category
+	 */
+	static bool IsAllowedCategoryTag(const FGameplayTag& CategoryTag);
+
+	/**
+	 * @param NotificationType Notification type
+	 * @return Notification config, nullptr if type is not configured
+	 */
+	static const FInventoryNotificationConfig* FindNotificationConfig(const FString& NotificationType);
+
+	/**
+	 * @param RecipeGuid Recipe Guid
+	 * @return Recipe allowed by Crafting Config, nullptr if recipe is not allowed
+	 */
+	static UMounteaRecipeTemplate* FindRecipe(const FGuid& RecipeGuid);
+
+	/**
+	 * @return All recipes allowed by Crafting Config, indexed by Guid. Recipes are soft references, use FindRecipe to resolve them.
+	 */
+	static const TMap<FGuid, TSoftObjectPtr<UMounteaRecipeTemplate>>& GetAllowedRecipes();
+
+	/**
+	 * Resolves every allowed recipe once and keeps them referenced until next invalidation.
+	 * @return All recipes allowed by Crafting Config
+	 */
+	static const TSet<UMounteaRecipeTemplate*>& GetAllowedRecipeTemplates();
+
+	/**
+	 * Revision increases with every invalidation. Dependent caches compare it to detect stale data.
+	 * @return Current settings revision
+	 */
+	static uint32 GetRevision();
+
+	/**
+	 * Broadcast when allowed recipes change, either on invalidation or when recipes missing registry tags finish indexing.
+	 * Dependent caches of resolved recipes should rebuild from it.
+	 * @return Recipes changed delegate
+	 */
+	static FSimpleMulticastDelegate& OnRecipesChanged();
+
+	/** Drops cached data, it is rebuilt on next access. */
+	static void Invalidate();
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+
+private:
+
+	static FMounteaAdvancedInventorySettingsCache& Get();
+
+	void BuildIfNeeded();
+	void BuildRecipesIfNeeded();
+	void OnUnindexedRecipesLoaded(const TArray<TSoftObjectPtr<UMounteaRecipeTemplate>>& LoadedRecipes, const uint32 RequestRevision);
+
+	TObjectPtr<UMounteaAdvancedInventorySettingsConfig> InventoryConfig;
+	TMap<FString, FInventoryCategory> SortedCategories;
+	TMap<FString, FInventoryRarity> SortedRarities;
+	TMap<FString, int32> CategoryOrdinals;
+	TMap<FString, int32> RarityOrdinals;
+	TArray<FGameplayTag> SortedCategoryTags;
+	TSet<FGameplayTag> AllowedCategoryTags;
+	TMap<FGuid, TSoftObjectPtr<UMounteaRecipeTemplate>> RecipesByGuid;
+	TSet<UMounteaRecipeTemplate*> RecipeTemplates;
+	TSharedPtr<FStreamableHandle> UnindexedRecipesHandle;
+	FSimpleMulticastDelegate RecipesChanged;
+	uint32 Revision = 0;
+	bool bIsBuilt = false;
+	bool bRecipesBuilt = false;
+	bool bRecipeTemplatesBuilt = false;
+};
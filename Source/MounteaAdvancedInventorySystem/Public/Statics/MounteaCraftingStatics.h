@@ -169,12 +169,38 @@ public:
 		DisplayName="Is Crafting Possible")
 	static bool IsCraftingPossible(UObject* Target, UMounteaRecipeTemplate* TemplateToCraft);
 
+	/**
+	 * Returns how many times Recipe can be crafted and which ingredients are missing.
+	 * @param Target Crafting participant to query.
+	 * @param RecipeTemplate Recipe to resolve.
+	 * @return Craftability of the Recipe.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Mountea|Inventory & Equipment|Crafting|Participant",
+		meta=(MounteaGetter),
+		meta=(DefaultToSelf="Target"),
+		DisplayName="Get Recipe Craftability")
+	static FMounteaRecipeCraftability GetRecipeCraftability(UObject* Target, UMounteaRecipeTemplate* RecipeTemplate);
+
 	UFUNCTION(BlueprintCallable, Category = "Mountea|Inventory & Equipment|Crafting|Participant",
 		meta=(MounteaSetter),
 		meta=(DefaultToSelf="Target"),
 		DisplayName="Start Crafting")
 	static FMounteaCraftingResult StartCrafting(UObject* Target, UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients);
 
+	/**
+	 * Crafts Recipe up to CraftCount times at once. Ingredients are consumed and stacked result is added in single inventory transaction.
+	 * @param Target Crafting participant.
+	 * @param TemplateToCraft Recipe to craft.
+	 * @param Ingredients Ingredient option to consume. If not set, option allowing most crafts is used.
+	 * @param CraftCount Requested crafts count, limited by available ingredients and free space of result stack.
+	 * @return Crafting result with number of crafts performed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Mountea|Inventory & Equipment|Crafting|Participant",
+		meta=(MounteaSetter),
+		meta=(DefaultToSelf="Target"),
+		DisplayName="Start Crafting Multiple")
+	static FMounteaCraftingResult StartCraftingMultiple(UObject* Target, UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients, const int32 CraftCount);
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Mountea|Inventory & Equipment|Crafting|Participant",
 		meta=(MounteaGetter),
 		meta=(DefaultToSelf="Target"),
@@ -214,7 +240,14 @@ public:
 		DisplayName="Get All Recipe Templates")
 	static TSet<UMounteaRecipeTemplate*> GetAllRecipeTemplates();
 
+	/**
+	 * Native counterpart of GetAllRecipeTemplates, avoids copying the set.
+	 * @return All recipes allowed by Crafting Config, referenced until next settings invalidation
+	 */
+	static const TSet<UMounteaRecipeTemplate*>& GetAllRecipeTemplatesRef();
+
 	static FMounteaCraftingResult CraftItem(const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Target, const UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients);
+	static FMounteaCraftingResult CraftItems(const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Target, const UMounteaRecipeTemplate* TemplateToCraft, UMounteaRecipeIngredientsList* Ingredients, const int32 CraftCount);
 	
 	static bool HasInventoryItemForRecipeSourceCached(
 		const TScriptInterface<IMounteaAdvancedInventoryInterface>& Inventory,
@@ -249,6 +282,22 @@ public:
 		const TScriptInterface<IMounteaAdvancedInventoryInterface>& Inventory,
 		const TArray<UMounteaRecipeTemplate*>& SourceRecipes);
 
+	static TArray<UMounteaRecipeTemplate*> ApplyIngredientAvailabilityFilter(
+		UObject* Target,
+		const TScriptInterface<IMounteaAdvancedInventoryInterface>& Inventory,
+		const TArray<UMounteaRecipeTemplate*>& SourceRecipes);
+
+	/**
+	 * Resolves craftability of Recipe from precomputed template quantities.
+	 * Ingredient templates which are not loaded are treated as unavailable, nothing is loaded here.
+	 * @param Recipe Recipe to resolve.
+	 * @param IngredientQuantities Total Inventory quantity per ingredient template.
+	 * @return Craftability of the Recipe.
+	 */
+	static FMounteaRecipeCraftability CalculateRecipeCraftability(
+		UMounteaRecipeTemplate* Recipe,
+		const TMap<TObjectPtr<UMounteaInventoryItemTemplate>, int32>& IngredientQuantities);
+
 	static bool IsRecipeInCategory(
 		const UMounteaRecipeTemplate* Recipe,
 		const FGameplayTag& CategoryTag);
@@ -325,6 +374,46 @@ public:
 		meta=(DefaultToSelf="Target"),
 		DisplayName="Stop Using Station")
 	static bool StopUsing(UObject* Target, const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant);
+
+	/**
+	 * Queues timed crafting of Recipe on Station. Each unit takes Recipe's Crafting Time.
+	 * @param Target Crafting station to queue the job on.
+	 * @param Participant Participant whose inventory is used.
+	 * @param Recipe Recipe to craft.
+	 * @param Ingredients Ingredient option to craft with.
+	 * @param Quantity How many times Recipe is crafted.
+	 * @return Guid of queued job, invalid if job was rejected. On clients the Guid is provisional,
+	 * server validates it and Station broadcasts On Crafting Job Rejected with it if the job is refused.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Mountea|Inventory & Equipment|Crafting|Station",
+		meta=(MounteaSetter),
+		meta=(DefaultToSelf="Target"),
+		DisplayName="Enqueue Crafting Job")
+	static FGuid EnqueueCraftingJob(UObject* Target, const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface>& Participant, UMounteaRecipeTemplate* Recipe, UMounteaRecipeIngredientsList* Ingredients, const int32 Quantity = 1);
+
+	UFUNCTION(BlueprintCallable, Category = "Mountea|Inventory & Equipment|Crafting|Station",
+		meta=(MounteaSetter),
+		meta=(DefaultToSelf="Target"),
+		DisplayName="Cancel Crafting Job")
+	static bool CancelCraftingJob(UObject* Target, const FGuid& JobGuid);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Mountea|Inventory & Equipment|Crafting|Station",
+		meta=(MounteaGetter),
+		meta=(DefaultToSelf="Target"),
+		DisplayName="Get Crafting Jobs")
+	static TArray<FMounteaCraftingJob> GetCraftingJobs(UObject* Target);
+
+	/**
+	 * Returns progress of currently crafted unit of the job, interpolated locally from replicated start time.
+	 * @param Target Crafting station the job is queued on.
+	 * @param JobGuid Job to query.
+	 * @return Progress in range 0-1, 0 for waiting or unknown jobs.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Mountea|Inventory & Equipment|Crafting|Station",
+		meta=(MounteaGetter),
+		meta=(DefaultToSelf="Target"),
+		DisplayName="Get Crafting Job Progress")
+	static float GetCraftingJobProgress(UObject* Target, const FGuid& JobGuid);
 	
 /**
  * HELPERS
@@ -293,6 +293,18 @@ public:
 	static bool CreateEquipmentItemAndAttach(UObject* Outer, const FMounteaInventoryItem& ItemDefinition, const UMounteaAdvancedAttachmentSlot* TargetSlot, 
 		AActor*& OutSpawnedActor);
 
+	/**
+	 * Defers equip request until item's SpawnActor class is streamed in, equip is retried once it loads.
+	 *
+	 * Equipment components track the request themselves, see UMounteaEquipmentComponent::IsEquipmentLoadPending.
+	 *
+	 * @param Outer  Attachment/equipment container context.
+	 * @param ItemDefinition  Item to equip.
+	 * @param TargetSlotId  Slot to equip to, NAME_None to use preferred slot resolution.
+	 * @return  True if request was deferred, false if class is already loaded or cannot be loaded.
+	 */
+	static bool DeferUntilSpawnActorLoaded(UObject* Outer, const FMounteaInventoryItem& ItemDefinition, const FName& TargetSlotId);
+
 	/**
 	 * General equip entry that validates request and uses preferred slot resolution.
 	 *
@@ -392,6 +404,22 @@ public:
 		const FGameplayTagContainer& DesiredTags,
 		const FGameplayTag& EquipmentItemType);
 
+	/**
+	 * Returns all compatible slot ids for given tags, ordered by the same ranking as ResolveBestSlotIdFromTags.
+	 * Ranking is cached per tag set and item type and rebuilt only when equipment settings change.
+	 *
+	 * @param DesiredTags  Required slot tags to match against FMounteaEquipmentSlotHeaderData::TagContainer.
+	 * @param EquipmentItemType  Optional item type compatibility filter from item template.
+	 * @return  Ranked slot ids, best candidate first. Empty if no compatible candidate exists.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Equipment",
+		meta=(MounteaGetter),
+		meta=(AutoCreateRefTerm="DesiredTags,EquipmentItemType"),
+		DisplayName="Get Ranked Slot Ids From Tags")
+	static TArray<FName> GetRankedSlotIdsFromTags(
+		const FGameplayTagContainer& DesiredTags,
+		const FGameplayTag& EquipmentItemType);
+
 	/**
 	 * Finds the attachment slot where a specific equipped item lives.
 	 *
@@ -445,6 +473,7 @@ public:
 	 * Resolves inventory item definition by GUID from local inventory contexts.
 	 *
 	 * Search order: Outer (if inventory), owning actor (if inventory), then owning actor inventory components.
+	 * Equipment components resolve these inventories once and cache them.
 	 *
 	 * @param Outer  Context object.
 	 * @param ItemGuid  GUID to resolve.
@@ -453,6 +482,16 @@ public:
 	 */
 	static bool TryResolveInventoryItemByGuid(UObject* Outer, const FGuid& ItemGuid, FMounteaInventoryItem& OutItemDefinition);
 
+	/**
+	 * Collects inventory objects reachable from context.
+	 *
+	 * Order: Outer (if inventory), owning actor (if inventory), then owning actor inventory components.
+	 *
+	 * @param Outer  Context object.
+	 * @return  Inventory objects in lookup order.
+	 */
+	static TArray<UObject*> ResolveInventoryObjects(UObject* Outer);
+
 	/**
 	 * Spawns and prepares a non-replicated quick-use placeholder actor for animation visuals.
 	 *
@@ -478,6 +517,18 @@ public:
 	static bool IsSlotBlockedByCurrentAttachments(const UObject* Outer, const UMounteaAdvancedAttachmentSlotBase* TargetSlot,
 		bool bIgnoreTargetSlotOccupant = true);
 
+	/**
+	 * Evaluates blocking of all container slots at once.
+	 *
+	 * Tags of active attachments are gathered in single pass, BlockedByTags of each slot are then tested
+	 * against them, so resolving multiple slots does not rescan attachments per slot.
+	 *
+	 * @param Outer  Attachment/equipment container context.
+	 * @param bIgnoreSlotOccupant  If true, slot's own occupant is ignored for its block evaluation.
+	 * @return  Bit per slot in GetAttachmentSlots order, set if slot is currently blocked.
+	 */
+	static TBitArray<> GetSlotsBlockedByCurrentAttachments(const UObject* Outer, bool bIgnoreSlotOccupant = true);
+
 	/**
 	 * Clears occupants from slots blocked by provided attachment tags.
 	 *
@@ -496,7 +547,7 @@ public:
 	/**
 	 * Ensures target slot can accept a new equip operation.
 	 *
-	 * If occupied, existing attachment is detached and owning actor is destroyed.
+	 * If occupied, existing attachment is detached and owning actor is released to the actor pool.
 	 *
 	 * @param Outer  Attachment/equipment container context.
 	 * @param TargetSlot  Slot to prepare.
@@ -512,6 +563,26 @@ public:
 	 */
 	static AActor* ResolveAttachmentActor(UObject* AttachmentObject);
 
+	/**
+	 * Acquires an equipment visual actor, reusing a pooled one of the same class when available.
+	 *
+	 * @param Outer  Context object providing the world.
+	 * @param ActorClass  Class of the actor to acquire.
+	 * @param SpawnParams  Spawn parameters used when no pooled actor is available.
+	 * @return  Acquired actor, or nullptr on failure.
+	 */
+	static AActor* AcquireEquipmentActor(const UObject* Outer, UClass* ActorClass, const FActorSpawnParameters& SpawnParams);
+
+	/**
+	 * Releases a detached equipment visual actor back to the actor pool.
+	 *
+	 * Equipped item id and state are reset so the actor can be reused for another item.
+	 * Actor is destroyed if no pool is available.
+	 *
+	 * @param Actor  Detached actor to release.
+	 */
+	static void ReleaseEquipmentActor(AActor* Actor);
+
 #pragma endregion
 	
 #pragma region Equipment
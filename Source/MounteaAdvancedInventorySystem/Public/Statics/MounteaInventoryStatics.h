@@ -24,6 +24,7 @@ class UMounteaAdvancedInventoryPayloadsConfig;
 class UMounteaSelectableInventoryItemAction;
 class UMounteaCallbackInventoryItemAction;
 class UMounteaInventoryItemAction;
+class UMounteaInventoryItemsView;
 
 struct FPayloadConfig;
 
@@ -395,6 +396,16 @@ public:
 		meta=(MounteaGetter))
 	static TArray<FMounteaInventoryItem> FindItems(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target, const FInventoryItemSearchParams& SearchParams);
 
+	/**
+	 * Creates View which keeps Items matching Search conditions sorted as Inventory changes.
+	 * @param Target The inventory interface to bind View to
+	 * @param SearchParams Search params Items must match
+	 * @param SortingCriteria Criteria Items are sorted by
+	 * @return New Items View or nullptr if Target is invalid
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Inventory|Search")
+	static UMounteaInventoryItemsView* CreateInventoryItemsView(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target, const FInventoryItemSearchParams& SearchParams, const TArray<FInventorySortCriteria>& SortingCriteria);
+
 	/**
 	 * Gets all items in inventory
 	 * @param Target The inventory interface to execute on
@@ -422,6 +433,17 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Inventory|Management", 
 		meta=(MounteaGetter))
 	static bool HasItem(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target, const FInventoryItemSearchParams& SearchParams);
+
+	/**
+	 * Executes multiple inventory mutations as a single atomic transaction.
+	 * All operations are validated first and applied only if every one of them succeeds.
+	 * @param Target The inventory interface to execute on
+	 * @param Operations Operations to apply, in order
+	 * @return True if the transaction was applied (or sent to server)
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Inventory|Management", 
+		meta=(MounteaSetter))
+	static bool ExecuteTransaction(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target, const TArray<FInventoryTransactionOperation>& Operations);
 	
 #pragma endregion 
 	
@@ -468,6 +490,57 @@ public:
 		UPARAM(meta=(UIMin=0.f,ClampMin=0.f)) float DeltaDurability);
 	
 #pragma endregion
+
+#pragma region Capacity
+
+	/**
+	 * Gets capacity limits enforced by the inventory
+	 * @param Target The inventory interface to execute on
+	 * @return Capacity limits
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Inventory|Capacity", 
+		meta=(MounteaGetter))
+	static FInventoryCapacityLimits GetCapacityLimits(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target);
+
+	/**
+	 * Sets capacity limits enforced by the inventory. Items already stored are not removed.
+	 * @param Target The inventory interface to execute on
+	 * @param NewLimits New capacity limits
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Inventory|Capacity",
+		BlueprintAuthorityOnly,
+		meta=(MounteaSetter))
+	static void SetCapacityLimits(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target, const FInventoryCapacityLimits& NewLimits);
+
+	/**
+	 * Gets total weight of all items in inventory
+	 * @param Target The inventory interface to execute on
+	 * @return Current weight
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Inventory|Capacity", 
+		meta=(MounteaGetter))
+	static float GetCurrentWeight(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target);
+
+	/**
+	 * Gets number of occupied item slots
+	 * @param Target The inventory interface to execute on
+	 * @return Number of distinct items in inventory
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Inventory|Capacity", 
+		meta=(MounteaGetter))
+	static int32 GetOccupiedSlots(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target);
+
+	/**
+	 * Gets total quantity of items in category
+	 * @param Target The inventory interface to execute on
+	 * @param CategoryId Category to check
+	 * @return Total quantity of items in category
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Inventory|Capacity", 
+		meta=(MounteaGetter))
+	static int32 GetCategoryQuantity(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Target, const FString& CategoryId);
+
+#pragma endregion
 	
 #pragma region Notification
 	
@@ -483,6 +556,9 @@ public:
 	static FInventoryNotificationData CreateNotificationData(const FString& Type, const TScriptInterface<IMounteaAdvancedInventoryInterface>& SourceInventory,
 		const FGuid& ItemGuid, const int32 QuantityDelta
 	);
+	static FInventoryNotificationData CreateNotificationData(const FString& Type, const TScriptInterface<IMounteaAdvancedInventoryInterface>& SourceInventory,
+		const FMounteaInventoryItem& Item, const int32 QuantityDelta
+	);
 #pragma endregion 
 	
 	/**
@@ -634,12 +710,16 @@ public:
 	
 	/**
 	 * Sorts provided Inventory Items based on Sorting Criteria.
+	 * Sort keys are resolved once per Item and all criteria are applied in a single sort, lowest priority criteria being the primary key.
 	 * 
 	 * Defaults:
 	 * * Name
 	 * * Value
 	 * * Weight
 	 * * Rarity
+	 * * Category
+	 * * Quantity
+	 * * Durability
 	 * 
 	 * @param Items List of cached Items. This is to avoid touching the "source" Items, so we rather sort temp. data.
 	 * @param SortingCriteria Defines what criteria are applied
@@ -49,6 +49,34 @@ public:
 		meta=(DefaultToSelf="Target"),
 		DisplayName="Load Loadout")
 	static bool LoadLoadout(UObject* Target);
+
+	/**
+	 * Executes loadout processing on the target with reproducible random quantities.
+	 * Seed is only accepted on authority, on clients regular load is requested instead.
+	 *
+	 * @param Target Object implementing loadouts interface.
+	 * @param RandomSeed Seed of the random stream used for random quantities.
+	 * @return True if loadout execution succeeded.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Loadout",
+		meta=(MounteaSetter),
+		meta=(DefaultToSelf="Target"),
+		DisplayName="Load Loadout With Seed")
+	static bool LoadLoadoutWithSeed(UObject* Target, const int32 RandomSeed);
+
+	/**
+	 * Resolves quantities granted by loadout entries for given seed without touching any inventory.
+	 *
+	 * Random quantities are drawn in entry order from single stream, matching what Load Loadout With Seed grants.
+	 *
+	 * @param Items Loadout entries to resolve.
+	 * @param RandomSeed Seed of the random stream used for random quantities.
+	 * @return Quantity per entry, 0 for invalid entries.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Loadout",
+		meta=(MounteaGetter),
+		DisplayName="Resolve Loadout Quantities")
+	static TArray<int32> ResolveLoadoutQuantities(const TArray<UMounteaAdvancedInventoryLoadoutItem*>& Items, const int32 RandomSeed);
 	
 	/**
 	 * Returns loadout configuration currently used by the target.
@@ -0,0 +1,108 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MounteaEquipmentActorPoolSubsystem.generated.h"
+
+/**
+ * Inactive actors of single class waiting to be reused.
+ */
+USTRUCT()
+struct FMounteaPooledEquipmentActors
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AActor>> Actors;
+};
+
+/**
+ * UMounteaEquipmentActorPoolSubsystem keeps detached equipment visuals alive so they can be reused.
+ * Equip and quick-use flows acquire actors by class instead of spawning them, unequip flows
+ * return them hidden and with collision disabled instead of destroying them.
+ *
+ * @see UMounteaEquipmentStatics::CreateEquipmentItemAndAttach
+ * @see UMounteaEquipmentStatics::SpawnQuickUsePlaceholderActor
+ */
+UCLASS(ClassGroup=(Mountea),
+	meta=(DisplayName="Mountea Equipment Actor Pool Subsystem"))
+class MOUNTEAADVANCEDINVENTORYSYSTEM_API UMounteaEquipmentActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Returns pooled actor of requested class, or spawns a new one if pool is empty.
+	 *
+	 * Reused actor is made visible again, collision is restored and the new owner is assigned.
+	 * Reused actor skips BeginPlay, so it and its components are notified through IMounteaAdvancedPooledActorInterface.
+	 *
+	 * @param ActorClass  Class of the actor to acquire.
+	 * @param SpawnParams  Parameters used when new actor has to be spawned. Owner is applied to reused actors as well.
+	 * @return  Ready to use actor, or nullptr if spawning failed.
+	 */
+	AActor* AcquireActor(UClass* ActorClass, const FActorSpawnParameters& SpawnParams);
+
+	/**
+	 * Returns actor into the pool of its class.
+	 *
+	 * Actor gets detached, hidden and its collision and tick are disabled.
+	 * Actor and its components implementing IMounteaAdvancedPooledActorInterface are notified first.
+	 * If the pool of its class is already full, actor is destroyed instead.
+	 *
+	 * @param Actor  Actor to release.
+	 * @return  True if actor was pooled, false if it was destroyed or invalid.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Equipment|Subsystem",
+		meta=(MounteaSetter),
+		DisplayName="Release Equipment Actor")
+	bool ReleaseActor(AActor* Actor);
+
+	/**
+	 * Destroys all pooled actors.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Inventory & Equipment|Equipment|Subsystem",
+		meta=(MounteaSetter),
+		DisplayName="Clear Equipment Actor Pool")
+	void ClearPool();
+
+	/**
+	 * Returns number of inactive actors currently pooled for the class.
+	 *
+	 * @param ActorClass  Class to check.
+	 * @return  Number of pooled actors.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Inventory & Equipment|Equipment|Subsystem",
+		meta=(MounteaGetter),
+		DisplayName="Get Pooled Actors Count")
+	int32 GetPooledActorsCount(const TSubclassOf<AActor> ActorClass) const;
+
+	/** Returns pool subsystem of the world the object lives in, if any. */
+	static UMounteaEquipmentActorPoolSubsystem* Get(const UObject* WorldContextObject);
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	// Upper limit of inactive actors kept per class, surplus actors are destroyed.
+	static constexpr int32 MaxPooledActorsPerClass = 8;
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FMounteaPooledEquipmentActors> PooledActors;
+};
@@ -0,0 +1,272 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Commandlets/MounteaInventoryBenchmarkCommandlet.h"
+
+#include "Components/MounteaCraftingParticipantComponent.h"
+#include "Components/MounteaInventoryComponent.h"
+#include "Definitions/MounteaCraftingBaseDataTypes.h"
+#include "Definitions/MounteaInventoryBaseDataTypes.h"
+#include "Definitions/MounteaInventoryItemTemplate.h"
+#include "Definitions/MounteaRecipeTemplate.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Interfaces/Crafting/MounteaAdvancedCraftingParticipantInterface.h"
+#include "Logs/MounteaAdvancedInventoryLog.h"
+#include "Statics/MounteaCraftingStatics.h"
+#include "Statics/MounteaInventoryStatics.h"
+#include "Tests/MounteaInventoryTestPackageMap.h"
+#include "Tests/MounteaInventoryTestUtilities.h"
+#include "UObject/CoreNet.h"
+
+namespace MounteaInventoryBenchmark
+{
+	/** Scoped timer printing average milliseconds per iteration. */
+	struct FScopedOperationTimer
+	{
+		FScopedOperationTimer(const TCHAR* InOperation, const int32 InItemCount, const int32 InIterations)
+			: Operation(InOperation)
+			, ItemCount(InItemCount)
+			, Iterations(FMath::Max(1, InIterations))
+			, StartTime(FPlatformTime::Seconds())
+		{}
+
+		~FScopedOperationTimer()
+		{
+			const double totalMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			UE_LOG(LogMounteaAdvancedInventorySystem, Display, TEXT("[Benchmark] %-32s items=%-6d avg=%10.3f ms  total=%10.3f ms"),
+				Operation, ItemCount, totalMs / Iterations, totalMs);
+		}
+
+		const TCHAR* Operation;
+		int32 ItemCount;
+		int32 Iterations;
+		double StartTime;
+	};
+
+	/** Records a failed check without aborting the remaining operations. */
+	static bool Check(const bool bCondition, const TCHAR* Description, const int32 ItemCount, bool& bOutSuccess)
+	{
+		if (!bCondition)
+		{
+			UE_LOG(LogMounteaAdvancedInventorySystem, Error, TEXT("[Benchmark] Check failed (items=%d): %s"), ItemCount, Description);
+			bOutSuccess = false;
+		}
+		return bCondition;
+	}
+}
+
+UMounteaInventoryBenchmarkCommandlet::UMounteaInventoryBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UMounteaInventoryBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString sizesParam = TEXT("10,1000,50000");
+	FParse::Value(*Params, TEXT("Sizes="), sizesParam);
+
+	int32 iterations = 5;
+	FParse::Value(*Params, TEXT("Iterations="), iterations);
+	iterations = FMath::Max(1, iterations);
+
+	TArray<FString> sizeTokens;
+	sizesParam.ParseIntoArray(sizeTokens, TEXT(","), true);
+
+	const MounteaInventoryTestUtilities::FScopedTestWorld benchmarkWorld(TEXT("MounteaInventoryBenchmarkWorld"));
+	if (!IsValid(benchmarkWorld.World))
+	{
+		UE_LOG(LogMounteaAdvancedInventorySystem, Error, TEXT("[Benchmark] Failed to create benchmark world"));
+		return 1;
+	}
+
+	bool bAllPassed = true;
+	for (const FString& sizeToken : sizeTokens)
+	{
+		const int32 itemCount = FCString::Atoi(*sizeToken);
+		if (itemCount <= 0)
+			continue;
+
+		bAllPassed &= RunBenchmark(benchmarkWorld.World, itemCount, iterations);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	UE_LOG(LogMounteaAdvancedInventorySystem, Display, TEXT("[Benchmark] Finished: %s"), bAllPassed ? TEXT("all checks passed") : TEXT("some checks FAILED"));
+	return bAllPassed ? 0 : 1;
+}
+
+bool UMounteaInventoryBenchmarkCommandlet::RunBenchmark(UWorld* World, const int32 ItemCount, const int32 Iterations) const
+{
+	using namespace MounteaInventoryBenchmark;
+	using namespace MounteaInventoryTestUtilities;
+
+	bool bSuccess = true;
+
+	const TArray<UMounteaInventoryItemTemplate*> templates = CreateSyntheticTemplates(ItemCount);
+	const TArray<UMounteaRecipeTemplate*> recipes = CreateSyntheticRecipes(templates, FMath::Min(ItemCount, 500));
+
+	UMounteaInventoryComponent* inventory = CreateInventory(World);
+	if (!Check(IsValid(inventory), TEXT("Inventory component created"), ItemCount, bSuccess))
+		return false;
+
+	const TScriptInterface<IMounteaAdvancedInventoryInterface> inventoryInterface = inventory;
+
+	// --- AddItem ------------------------------
+	{
+		FScopedOperationTimer timer(TEXT("AddItemFromTemplate"), ItemCount, 1);
+		for (UMounteaInventoryItemTemplate* itemTemplate : templates)
+			UMounteaInventoryStatics::AddItemFromTemplate(inventoryInterface, itemTemplate, 2, 1.f);
+	}
+
+	TArray<FMounteaInventoryItem> allItems = UMounteaInventoryStatics::GetAllItems(inventoryInterface);
+	Check(allItems.Num() == ItemCount, TEXT("AddItem produced one slot per template"), ItemCount, bSuccess);
+
+	// --- Stacking onto existing slots ------------------------------
+	{
+		FScopedOperationTimer timer(TEXT("AddItemFromTemplate (stack)"), ItemCount, 1);
+		for (UMounteaInventoryItemTemplate* itemTemplate : templates)
+			UMounteaInventoryStatics::AddItemFromTemplate(inventoryInterface, itemTemplate, 1, 1.f);
+	}
+
+	Check(UMounteaInventoryStatics::GetAllItems(inventoryInterface).Num() == ItemCount, TEXT("Stacking did not create new slots"), ItemCount, bSuccess);
+	Check(UMounteaInventoryStatics::FindItem(inventoryInterface, FInventoryItemSearchParams(templates.Last())).GetQuantity() == 3,
+		TEXT("Stacking increased quantity"), ItemCount, bSuccess);
+
+	// --- FindItems ------------------------------
+	{
+		const int32 lookups = FMath::Min(ItemCount, 1000);
+		int32 foundCount = 0;
+		{
+			FScopedOperationTimer timer(TEXT("FindItems (template)"), ItemCount, lookups);
+			for (int32 i = 0; i < lookups; ++i)
+				foundCount += UMounteaInventoryStatics::FindItems(inventoryInterface, FInventoryItemSearchParams(templates[i])).Num();
+		}
+		Check(foundCount == lookups, TEXT("FindItems by template returns exactly one slot"), ItemCount, bSuccess);
+
+		FInventoryItemSearchParams categoryParams;
+		categoryParams.bSearchByCategory = true;
+		categoryParams.CategoryId = Categories[0];
+
+		TArray<FMounteaInventoryItem> categoryItems;
+		{
+			FScopedOperationTimer timer(TEXT("FindItems (category)"), ItemCount, Iterations);
+			for (int32 i = 0; i < Iterations; ++i)
+				categoryItems = UMounteaInventoryStatics::FindItems(inventoryInterface, categoryParams);
+		}
+		const int32 expectedCategoryItems = (ItemCount + UE_ARRAY_COUNT(Categories) - 1) / UE_ARRAY_COUNT(Categories);
+		Check(categoryItems.Num() == expectedCategoryItems, TEXT("FindItems by category matches synthetic distribution"), ItemCount, bSuccess);
+
+		int32 guidHits = 0;
+		{
+			FScopedOperationTimer timer(TEXT("FindItem (guid)"), ItemCount, lookups);
+			for (int32 i = 0; i < lookups; ++i)
+				guidHits += UMounteaInventoryStatics::FindItem(inventoryInterface, FInventoryItemSearchParams(allItems[i].GetGuid())).IsItemValid() ? 1 : 0;
+		}
+		Check(guidHits == lookups, TEXT("FindItem by guid finds every item"), ItemCount, bSuccess);
+	}
+
+	allItems = UMounteaInventoryStatics::GetAllItems(inventoryInterface);
+
+	// --- SortInventoryItems ------------------------------
+	{
+		TArray<FInventorySortCriteria> sortCriteria;
+		const auto addCriteria = [&sortCriteria](const int32 Priority, const TCHAR* Key)
+		{
+			FInventorySortCriteria& criteria = sortCriteria.AddDefaulted_GetRef();
+			criteria.SortPriority = Priority;
+			criteria.SortingKey = Key;
+		};
+		addCriteria(2, TEXT("Rarity"));
+		addCriteria(1, TEXT("Name"));
+		addCriteria(0, TEXT("Value"));
+
+		TArray<FMounteaInventoryItem> sortedItems;
+		{
+			FScopedOperationTimer timer(TEXT("SortInventoryItems (3 keys)"), ItemCount, Iterations);
+			for (int32 i = 0; i < Iterations; ++i)
+				sortedItems = UMounteaInventoryStatics::SortInventoryItems(allItems, sortCriteria);
+		}
+		Check(sortedItems.Num() == allItems.Num(), TEXT("Sorting preserves item count"), ItemCount, bSuccess);
+
+		bool bValueOrdered = true;
+		for (int32 i = 1; i < sortedItems.Num() && bValueOrdered; ++i)
+		{
+			bValueOrdered = sortedItems[i - 1].GetTemplate()->BasePrice * sortedItems[i - 1].GetQuantity()
+				<= sortedItems[i].GetTemplate()->BasePrice * sortedItems[i].GetQuantity();
+		}
+		Check(bValueOrdered, TEXT("Last applied criterion (Value) is ordered"), ItemCount, bSuccess);
+	}
+
+	// --- GetFilteredRecipes ------------------------------
+	{
+		UMounteaCraftingParticipantComponent* participant = CreateParticipant(inventory);
+		if (Check(IsValid(participant), TEXT("Crafting participant created"), ItemCount, bSuccess))
+		{
+			for (UMounteaRecipeTemplate* recipe : recipes)
+				IMounteaAdvancedCraftingParticipantInterface::Execute_LearnRecipe(participant, recipe);
+
+			FMounteaCraftingRecipeSearchFilter searchFilter;
+			searchFilter.bSearchByAvailableIngredients = true;
+
+			TArray<UMounteaRecipeTemplate*> craftableRecipes;
+			{
+				FScopedOperationTimer timer(TEXT("GetFilteredRecipes (ingredients)"), ItemCount, Iterations);
+				for (int32 i = 0; i < Iterations; ++i)
+					craftableRecipes = UMounteaCraftingStatics::GetFilteredRecipes(participant, searchFilter);
+			}
+			Check(craftableRecipes.Num() == recipes.Num(), TEXT("All synthetic recipes are craftable"), ItemCount, bSuccess);
+		}
+	}
+
+	// --- NetSerialize ------------------------------
+	{
+		UMounteaInventoryTestPackageMap* packageMap = NewObject<UMounteaInventoryTestPackageMap>();
+		int64 totalBits = 0;
+		int32 roundTripFailures = 0;
+		{
+			FScopedOperationTimer timer(TEXT("NetSerialize (write+read)"), ItemCount, 1);
+			for (FMounteaInventoryItem& item : allItems)
+			{
+				bool bOutSuccess = true;
+				FNetBitWriter writer(packageMap, 0);
+				item.NetSerialize(writer, packageMap, bOutSuccess);
+				totalBits += writer.GetNumBits();
+
+				FNetBitReader reader(packageMap, writer.GetData(), writer.GetNumBits());
+				FMounteaInventoryItem readItem;
+				readItem.NetSerialize(reader, packageMap, bOutSuccess);
+				if (!bOutSuccess || readItem.GetGuid() != item.GetGuid() || readItem.GetQuantity() != item.GetQuantity()
+					|| readItem.GetTemplate() != item.GetTemplate())
+					++roundTripFailures;
+			}
+		}
+		UE_LOG(LogMounteaAdvancedInventorySystem, Display, TEXT("[Benchmark] NetSerialize average size: %.1f bits/item"),
+			allItems.Num() > 0 ? static_cast<double>(totalBits) / allItems.Num() : 0.0);
+		Check(roundTripFailures == 0, TEXT("NetSerialize round trip preserves guid, quantity and template"), ItemCount, bSuccess);
+	}
+
+	// --- RemoveItem ------------------------------
+	{
+		FScopedOperationTimer timer(TEXT("RemoveItem"), ItemCount, 1);
+		for (const FMounteaInventoryItem& item : allItems)
+			UMounteaInventoryStatics::RemoveItem(inventoryInterface, item.GetGuid());
+	}
+	Check(UMounteaInventoryStatics::GetAllItems(inventoryInterface).Num() == 0, TEXT("RemoveItem empties inventory"), ItemCount, bSuccess);
+
+	if (AActor* owningActor = inventory->GetOwner())
+		owningActor->Destroy();
+
+	return bSuccess;
+}
@@ -0,0 +1,473 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Components/MounteaCraftingParticipantComponent.h"
+#include "Components/MounteaCraftingStationComponent.h"
+#include "Components/MounteaInventoryComponent.h"
+#include "Definitions/MounteaAdvancedInventoryLoadoutItem.h"
+#include "Definitions/MounteaCraftingBaseDataTypes.h"
+#include "Definitions/MounteaInventoryBaseDataTypes.h"
+#include "Definitions/MounteaInventoryItem.h"
+#include "Definitions/MounteaInventoryItemTemplate.h"
+#include "Definitions/MounteaRecipeIngredient.h"
+#include "Definitions/MounteaRecipeIngredientsList.h"
+#include "Definitions/MounteaRecipeTemplate.h"
+#include "Engine/DemoNetConnection.h"
+#include "Engine/PackageMapClient.h"
+#include "Helpers/MounteaInventoryTemplateRegistry.h"
+#include "Interfaces/Crafting/MounteaAdvancedCraftingParticipantInterface.h"
+#include "Statics/MounteaCraftingStatics.h"
+#include "Statics/MounteaInventoryStatics.h"
+#include "Statics/MounteaLoadoutStatics.h"
+#include "Tests/MounteaInventoryTestPackageMap.h"
+#include "Tests/MounteaInventoryTestUtilities.h"
+#include "UObject/CoreNet.h"
+
+namespace MounteaInventoryAutomationTests
+{
+	constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter;
+
+	/** Total quantity of all stacks created from Template. */
+	static int32 GetTemplateQuantity(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Inventory, UMounteaInventoryItemTemplate* Template)
+	{
+		int32 returnValue = 0;
+		for (const FMounteaInventoryItem& item : UMounteaInventoryStatics::FindItems(Inventory, FInventoryItemSearchParams(Template)))
+			returnValue += item.GetQuantity();
+		return returnValue;
+	}
+
+	/** Adds Quantity of every ingredient of the first option of Recipe. */
+	static void AddRecipeIngredients(const TScriptInterface<IMounteaAdvancedInventoryInterface>& Inventory, const UMounteaRecipeTemplate* Recipe, const int32 Quantity)
+	{
+		for (const UMounteaRecipeIngredient* ingredient : Recipe->RecipeIngredientOptions[0]->RecipeIngredients)
+			UMounteaInventoryStatics::AddItemFromTemplate(Inventory, ingredient->IngredientSource.Get(), Quantity, 1.f);
+	}
+
+	/** Recipe with its own result template, so crafting does not feed its ingredients. */
+	static UMounteaRecipeTemplate* CreateCraftingRecipe(TArray<UMounteaInventoryItemTemplate*>& OutTemplates)
+	{
+		OutTemplates = MounteaInventoryTestUtilities::CreateSyntheticTemplates(20);
+		UMounteaRecipeTemplate* recipe = MounteaInventoryTestUtilities::CreateSyntheticRecipes(OutTemplates, 1)[0];
+		recipe->ResultItem = OutTemplates.Last();
+		recipe->RefreshResultMetadata();
+		return recipe;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaInventoryAddFindRemoveTest, "Mountea.Inventory.AddFindRemove", MounteaInventoryAutomationTests::TestFlags)
+
+bool FMounteaInventoryAddFindRemoveTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaInventoryTestUtilities;
+
+	const FScopedTestWorld testWorld(TEXT("MounteaInventoryAddFindRemoveTest"));
+	const TScriptInterface<IMounteaAdvancedInventoryInterface> inventory = CreateInventory(testWorld.World);
+	if (!TestNotNull(TEXT("Inventory"), inventory.GetObject()))
+		return false;
+
+	const TArray<UMounteaInventoryItemTemplate*> templates = CreateSyntheticTemplates(8);
+	for (UMounteaInventoryItemTemplate* itemTemplate : templates)
+		TestTrue(TEXT("AddItemFromTemplate"), UMounteaInventoryStatics::AddItemFromTemplate(inventory, itemTemplate, 2, 1.f));
+	TestEqual(TEXT("One slot per template"), UMounteaInventoryStatics::GetAllItems(inventory).Num(), templates.Num());
+
+	UMounteaInventoryStatics::AddItemFromTemplate(inventory, templates[0], 3, 1.f);
+	TestEqual(TEXT("Stacking keeps slot count"), UMounteaInventoryStatics::GetAllItems(inventory).Num(), templates.Num());
+	TestEqual(TEXT("Stacking increases quantity"), MounteaInventoryAutomationTests::GetTemplateQuantity(inventory, templates[0]), 5);
+
+	FInventoryItemSearchParams categoryParams;
+	categoryParams.bSearchByCategory = true;
+	categoryParams.CategoryId = Categories[1];
+	TestEqual(TEXT("FindItems by category"), UMounteaInventoryStatics::FindItems(inventory, categoryParams).Num(), 2);
+
+	const FMounteaInventoryItem foundItem = UMounteaInventoryStatics::FindItem(inventory, FInventoryItemSearchParams(templates[3]));
+	TestTrue(TEXT("FindItem by template"), foundItem.IsItemValid());
+	TestTrue(TEXT("FindItem by guid"), UMounteaInventoryStatics::FindItem(inventory, FInventoryItemSearchParams(foundItem.GetGuid())).IsItemValid());
+
+	TestTrue(TEXT("RemoveItem"), UMounteaInventoryStatics::RemoveItem(inventory, foundItem.GetGuid()));
+	TestFalse(TEXT("Removed item is not found"), UMounteaInventoryStatics::FindItem(inventory, FInventoryItemSearchParams(foundItem.GetGuid())).IsItemValid());
+	TestEqual(TEXT("RemoveItem frees slot"), UMounteaInventoryStatics::GetAllItems(inventory).Num(), templates.Num() - 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaInventorySortTest, "Mountea.Inventory.Sort", MounteaInventoryAutomationTests::TestFlags)
+
+bool FMounteaInventorySortTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaInventoryTestUtilities;
+
+	const FScopedTestWorld testWorld(TEXT("MounteaInventorySortTest"));
+	const TScriptInterface<IMounteaAdvancedInventoryInterface> inventory = CreateInventory(testWorld.World);
+	if (!TestNotNull(TEXT("Inventory"), inventory.GetObject()))
+		return false;
+
+	for (UMounteaInventoryItemTemplate* itemTemplate : CreateSyntheticTemplates(64))
+		UMounteaInventoryStatics::AddItemFromTemplate(inventory, itemTemplate, 1, 1.f);
+
+	FInventorySortCriteria sortCriteria;
+	sortCriteria.SortingKey = TEXT("Value");
+	const TArray<FMounteaInventoryItem> sortedItems = UMounteaInventoryStatics::SortInventoryItems(UMounteaInventoryStatics::GetAllItems(inventory), { sortCriteria });
+	if (!TestEqual(TEXT("Sorting preserves item count"), sortedItems.Num(), 64))
+		return false;
+
+	for (int32 i = 1; i < sortedItems.Num(); ++i)
+	{
+		if (!TestTrue(TEXT("Items are ordered by value"), sortedItems[i - 1].GetTemplate()->BasePrice <= sortedItems[i].GetTemplate()->BasePrice))
+			break;
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaInventoryNetSerializeTest, "Mountea.Inventory.NetSerialize", MounteaInventoryAutomationTests::TestFlags)
+
+bool FMounteaInventoryNetSerializeTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaInventoryTestUtilities;
+
+	UMounteaInventoryTestPackageMap* packageMap = NewObject<UMounteaInventoryTestPackageMap>();
+	const TArray<UMounteaInventoryItemTemplate*> templates = CreateSyntheticTemplates(2);
+
+	// Second template has no durability, so both durability encodings are covered
+	for (UMounteaInventoryItemTemplate* itemTemplate : templates)
+	{
+		FMounteaInventoryItem item(itemTemplate, 42, 0.5f);
+
+		bool bWriteSuccess = true;
+		FNetBitWriter writer(packageMap, 0);
+		item.NetSerialize(writer, packageMap, bWriteSuccess);
+		TestTrue(TEXT("Write succeeded"), bWriteSuccess);
+
+		bool bReadSuccess = true;
+		FNetBitReader reader(packageMap, writer.GetData(), writer.GetNumBits());
+		FMounteaInventoryItem readItem;
+		readItem.NetSerialize(reader, packageMap, bReadSuccess);
+		TestTrue(TEXT("Read succeeded"), bReadSuccess);
+
+		TestEqual(TEXT("Guid round trip"), readItem.GetGuid(), item.GetGuid());
+		TestEqual(TEXT("Quantity round trip"), readItem.GetQuantity(), item.GetQuantity());
+		TestTrue(TEXT("Template round trip"), readItem.GetTemplate() == item.GetTemplate());
+		if (itemTemplate->bHasDurability)
+			TestEqual(TEXT("Durability round trip"), readItem.GetDurability(), item.GetDurability(), 0.001f);
+	}
+
+	// Registered template replicated by the Inventory array to a verified client is sent as registry index
+	TArray<FAssetData> templateAssets;
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().GetAssetsByClass(
+		UMounteaInventoryItemTemplate::StaticClass()->GetClassPathName(), templateAssets, true);
+	UMounteaInventoryItemTemplate* registeredTemplate = templateAssets.Num() > 0 ? Cast<UMounteaInventoryItemTemplate>(templateAssets[0].GetAsset()) : nullptr;
+	if (!TestNotNull(TEXT("Registered template"), registeredTemplate))
+		return false;
+	TestNotEqual(TEXT("Registered template has registry index"), FMounteaInventoryTemplateRegistry::GetTemplateIndex(registeredTemplate), static_cast<int32>(INDEX_NONE));
+
+	UDemoNetConnection* clientConnection = NewObject<UDemoNetConnection>(GetTransientPackage());
+	UPackageMapClient* clientPackageMap = NewObject<UPackageMapClient>(clientConnection);
+	clientPackageMap->Initialize(clientConnection, nullptr);
+	TestFalse(TEXT("Unverified client receives full references"), FMounteaInventoryTemplateRegistry::CanUseIndices(clientPackageMap));
+	FMounteaInventoryTemplateRegistry::SetConnectionVerified(clientConnection);
+	TestTrue(TEXT("Verified client receives indices"), FMounteaInventoryTemplateRegistry::CanUseIndices(clientPackageMap));
+
+	FMounteaInventoryItem registeredItem(registeredTemplate, 3);
+
+	bool bReferenceWriteSuccess = true;
+	FNetBitWriter referenceWriter(packageMap, 0);
+	registeredItem.NetSerialize(referenceWriter, packageMap, bReferenceWriteSuccess);
+
+	bool bIndexWriteSuccess = true;
+	FNetBitWriter indexWriter(clientPackageMap, 0);
+	{
+		const FScopedInventoryItemArraySerialization arraySerialization(registeredItem);
+		registeredItem.NetSerialize(indexWriter, clientPackageMap, bIndexWriteSuccess);
+	}
+	TestTrue(TEXT("Indexed write succeeded"), bIndexWriteSuccess);
+	TestTrue(TEXT("Index is smaller than full reference"), indexWriter.GetNumBits() < referenceWriter.GetNumBits());
+
+	// Template is loaded, so the index resolves without package map or pending load
+	bool bIndexReadSuccess = true;
+	FNetBitReader indexReader(clientPackageMap, indexWriter.GetData(), indexWriter.GetNumBits());
+	FMounteaInventoryItem readRegisteredItem;
+	readRegisteredItem.NetSerialize(indexReader, clientPackageMap, bIndexReadSuccess);
+	TestTrue(TEXT("Indexed read succeeded"), bIndexReadSuccess);
+	TestFalse(TEXT("Indexed template is not pending"), readRegisteredItem.IsTemplatePending());
+	TestTrue(TEXT("Indexed template round trip"), readRegisteredItem.GetTemplate() == registeredTemplate);
+	TestEqual(TEXT("Indexed quantity round trip"), readRegisteredItem.GetQuantity(), registeredItem.GetQuantity());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaInventoryTransactionTest, "Mountea.Inventory.Transactions", MounteaInventoryAutomationTests::TestFlags)
+
+bool FMounteaInventoryTransactionTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaInventoryTestUtilities;
+	using MounteaInventoryAutomationTests::GetTemplateQuantity;
+
+	const FScopedTestWorld testWorld(TEXT("MounteaInventoryTransactionTest"));
+	const TScriptInterface<IMounteaAdvancedInventoryInterface> inventory = CreateInventory(testWorld.World);
+	if (!TestNotNull(TEXT("Inventory"), inventory.GetObject()))
+		return false;
+
+	const TArray<UMounteaInventoryItemTemplate*> templates = CreateSyntheticTemplates(3);
+	UMounteaInventoryStatics::AddItemFromTemplate(inventory, templates[0], 5, 1.f);
+	UMounteaInventoryStatics::AddItemFromTemplate(inventory, templates[1], 4, 1.f);
+	const FGuid firstGuid = UMounteaInventoryStatics::FindItem(inventory, FInventoryItemSearchParams(templates[0])).GetGuid();
+
+	const bool bCommitted = UMounteaInventoryStatics::ExecuteTransaction(inventory, {
+		FInventoryTransactionOperation::MakeAdd(FMounteaInventoryItem(templates[2], 2)),
+		FInventoryTransactionOperation::MakeQuantityChange(firstGuid, -2),
+		FInventoryTransactionOperation::MakeRemove(templates[1], 1)
+	});
+	TestTrue(TEXT("Valid transaction is committed"), bCommitted);
+	TestEqual(TEXT("Added item"), GetTemplateQuantity(inventory, templates[2]), 2);
+	TestEqual(TEXT("Changed quantity"), GetTemplateQuantity(inventory, templates[0]), 3);
+	TestEqual(TEXT("Removed by template"), GetTemplateQuantity(inventory, templates[1]), 3);
+
+	// Every operation but the last one is valid, none of them may be applied
+	const bool bRejected = !UMounteaInventoryStatics::ExecuteTransaction(inventory, {
+		FInventoryTransactionOperation::MakeAdd(FMounteaInventoryItem(templates[2], 1)),
+		FInventoryTransactionOperation::MakeRemove(firstGuid),
+		FInventoryTransactionOperation::MakeQuantityChange(FGuid::NewGuid(), 1)
+	});
+	TestTrue(TEXT("Transaction with unknown item is rejected"), bRejected);
+	TestEqual(TEXT("Rejected add is rolled back"), GetTemplateQuantity(inventory, templates[2]), 2);
+	TestEqual(TEXT("Rejected remove is rolled back"), GetTemplateQuantity(inventory, templates[0]), 3);
+
+	TestFalse(TEXT("Quantity cannot drop below zero"), UMounteaInventoryStatics::ExecuteTransaction(inventory, {
+		FInventoryTransactionOperation::MakeQuantityChange(firstGuid, -10)
+	}));
+	TestEqual(TEXT("Failed quantity change is rolled back"), GetTemplateQuantity(inventory, templates[0]), 3);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaInventoryCapacityTest, "Mountea.Inventory.Capacity", MounteaInventoryAutomationTests::TestFlags)
+
+bool FMounteaInventoryCapacityTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaInventoryTestUtilities;
+
+	const FScopedTestWorld testWorld(TEXT("MounteaInventoryCapacityTest"));
+	const TScriptInterface<IMounteaAdvancedInventoryInterface> inventory = CreateInventory(testWorld.World);
+	if (!TestNotNull(TEXT("Inventory"), inventory.GetObject()))
+		return false;
+
+	// Weights are 0.1, 1.1, 2.1 and 3.1, each template belongs to different category
+	const TArray<UMounteaInventoryItemTemplate*> templates = CreateSyntheticTemplates(4);
+
+	FInventoryCapacityLimits capacityLimits;
+	capacityLimits.bLimitSlots = true;
+	capacityLimits.MaxSlots = 2;
+	UMounteaInventoryStatics::SetCapacityLimits(inventory, capacityLimits);
+
+	TestTrue(TEXT("First slot"), UMounteaInventoryStatics::AddItemFromTemplate(inventory, templates[0], 1, 1.f));
+	TestTrue(TEXT("Second slot"), UMounteaInventoryStatics::AddItemFromTemplate(inventory, templates[1], 1, 1.f));
+	TestEqual(TEXT("Occupied slots"), UMounteaInventoryStatics::GetOccupiedSlots(inventory), 2);
+	TestFalse(TEXT("Slot limit blocks new stack"), UMounteaInventoryStatics::CanAddItemFromTemplate(inventory, templates[2], 1));
+	TestFalse(TEXT("Slot limit blocks adding"), UMounteaInventoryStatics::AddItemFromTemplate(inventory, templates[2], 1, 1.f));
+	TestTrue(TEXT("Slot limit allows stacking"), UMounteaInventoryStatics::CanAddItemFromTemplate(inventory, templates[0], 5));
+
+	capacityLimits.bLimitSlots = false;
+	capacityLimits.bLimitWeight = true;
+	capacityLimits.MaxWeight = 5.f;
+	UMounteaInventoryStatics::SetCapacityLimits(inventory, capacityLimits);
+
+	TestEqual(TEXT("Current weight"), UMounteaInventoryStatics::GetCurrentWeight(inventory), 1.2f, 0.001f);
+	TestTrue(TEXT("Item within weight limit"), UMounteaInventoryStatics::AddItemFromTemplate(inventory, templates[2], 1, 1.f));
+	TestFalse(TEXT("Item over weight limit"), UMounteaInventoryStatics::CanAddItemFromTemplate(inventory, templates[3], 1));
+	TestEqual(TEXT("Weight after add"), UMounteaInventoryStatics::GetCurrentWeight(inventory), 3.3f, 0.001f);
+
+	capacityLimits.bLimitWeight = false;
+	capacityLimits.bLimitCategories = true;
+	capacityLimits.CategoryLimits.Add(templates[0]->ItemCategory, 3);
+	UMounteaInventoryStatics::SetCapacityLimits(inventory, capacityLimits);
+
+	TestEqual(TEXT("Category quantity"), UMounteaInventoryStatics::GetCategoryQuantity(inventory, templates[0]->ItemCategory), 1);
+	TestTrue(TEXT("Quantity within category limit"), UMounteaInventoryStatics::CanAddItemFromTemplate(inventory, templates[0], 2));
+	TestFalse(TEXT("Quantity over category limit"), UMounteaInventoryStatics::CanAddItemFromTemplate(inventory, templates[0], 3));
+	TestTrue(TEXT("Unlimited category"), UMounteaInventoryStatics::CanAddItemFromTemplate(inventory, templates[3], 10));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaCraftingFilteredRecipesTest, "Mountea.Inventory.Crafting.FilteredRecipes", MounteaInventoryAutomationTests::TestFlags)
+
+bool FMounteaCraftingFilteredRecipesTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaInventoryTestUtilities;
+
+	const FScopedTestWorld testWorld(TEXT("MounteaCraftingFilteredRecipesTest"));
+	UMounteaInventoryComponent* inventory = CreateInventory(testWorld.World);
+	UMounteaCraftingParticipantComponent* participant = CreateParticipant(inventory);
+	if (!TestNotNull(TEXT("Participant"), participant))
+		return false;
+
+	const TArray<UMounteaInventoryItemTemplate*> templates = CreateSyntheticTemplates(20);
+	const TArray<UMounteaRecipeTemplate*> recipes = CreateSyntheticRecipes(templates, 5);
+
+	FMounteaCraftingRecipeSearchFilter searchFilter;
+	searchFilter.bSearchByAvailableIngredients = true;
+	TestEqual(TEXT("Unknown recipes are not returned"), UMounteaCraftingStatics::GetFilteredRecipes(participant, searchFilter).Num(), 0);
+
+	for (UMounteaRecipeTemplate* recipe : recipes)
+		IMounteaAdvancedCraftingParticipantInterface::Execute_LearnRecipe(participant, recipe);
+
+	// Ingredients of the first two recipes do not overlap with the remaining ones
+	MounteaInventoryAutomationTests::AddRecipeIngredients(inventory, recipes[0], 1);
+	MounteaInventoryAutomationTests::AddRecipeIngredients(inventory, recipes[1], 1);
+
+	const TArray<UMounteaRecipeTemplate*> craftableRecipes = UMounteaCraftingStatics::GetFilteredRecipes(participant, searchFilter);
+	TestEqual(TEXT("Only craftable recipes are returned"), craftableRecipes.Num(), 2);
+	TestTrue(TEXT("First recipe is craftable"), craftableRecipes.Contains(recipes[0]));
+	TestTrue(TEXT("Second recipe is craftable"), craftableRecipes.Contains(recipes[1]));
+	TestEqual(TEXT("Without filters all known recipes are returned"),
+		UMounteaCraftingStatics::GetFilteredRecipes(participant, FMounteaCraftingRecipeSearchFilter()).Num(), recipes.Num());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaCraftingBulkCraftingTest, "Mountea.Inventory.Crafting.BulkCrafting", MounteaInventoryAutomationTests::TestFlags)
+
+bool FMounteaCraftingBulkCraftingTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaInventoryTestUtilities;
+	using MounteaInventoryAutomationTests::GetTemplateQuantity;
+
+	const FScopedTestWorld testWorld(TEXT("MounteaCraftingBulkCraftingTest"));
+	UMounteaInventoryComponent* inventory = CreateInventory(testWorld.World);
+	UMounteaCraftingParticipantComponent* participant = CreateParticipant(inventory);
+	if (!TestNotNull(TEXT("Participant"), participant))
+		return false;
+
+	TArray<UMounteaInventoryItemTemplate*> templates;
+	UMounteaRecipeTemplate* recipe = MounteaInventoryAutomationTests::CreateCraftingRecipe(templates);
+	UMounteaRecipeIngredientsList* ingredients = recipe->RecipeIngredientOptions[0];
+	UMounteaInventoryItemTemplate* firstIngredient = ingredients->RecipeIngredients[0]->IngredientSource.Get();
+	UMounteaInventoryItemTemplate* resultTemplate = templates.Last();
+
+	MounteaInventoryAutomationTests::AddRecipeIngredients(inventory, recipe, 3);
+	UMounteaInventoryStatics::AddItemFromTemplate(inventory, firstIngredient, 2, 1.f);
+
+	UMounteaRecipeIngredientsList* foreignIngredients = DuplicateObject(ingredients, GetTransientPackage());
+	TestFalse(TEXT("Ingredients of other recipe are rejected"), UMounteaCraftingStatics::CraftItems(participant, recipe, foreignIngredients, 1).bCraftingSuccess);
+	TestEqual(TEXT("Rejected crafting keeps ingredients"), GetTemplateQuantity(inventory, firstIngredient), 5);
+
+	// Ingredients allow 3 crafts, result stack only 2
+	resultTemplate->MaxQuantity = 2;
+	const FMounteaCraftingResult limitedResult = UMounteaCraftingStatics::CraftItems(participant, recipe, ingredients, 10);
+	TestTrue(TEXT("Bulk crafting succeeded"), limitedResult.bCraftingSuccess);
+	TestEqual(TEXT("Crafting is limited by result stack"), limitedResult.CraftedCount, 2);
+	TestEqual(TEXT("Crafted quantity"), GetTemplateQuantity(inventory, resultTemplate), 2);
+	TestEqual(TEXT("Ingredients consumed per craft"), GetTemplateQuantity(inventory, firstIngredient), 3);
+	TestFalse(TEXT("Full result stack blocks crafting"), UMounteaCraftingStatics::CraftItems(participant, recipe, ingredients, 1).bCraftingSuccess);
+
+	resultTemplate->MaxQuantity = 999;
+	const FMounteaCraftingResult ingredientResult = UMounteaCraftingStatics::CraftItems(participant, recipe, nullptr, 10);
+	TestTrue(TEXT("Crafting with best option succeeded"), ingredientResult.bCraftingSuccess);
+	TestEqual(TEXT("Crafting is limited by ingredients"), ingredientResult.CraftedCount, 1);
+	TestEqual(TEXT("Crafted quantity after second craft"), GetTemplateQuantity(inventory, resultTemplate), 3);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaCraftingQueueTest, "Mountea.Inventory.Crafting.Queue", MounteaInventoryAutomationTests::TestFlags)
+
+bool FMounteaCraftingQueueTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaInventoryTestUtilities;
+	using MounteaInventoryAutomationTests::GetTemplateQuantity;
+
+	const FScopedTestWorld testWorld(TEXT("MounteaCraftingQueueTest"));
+	UMounteaInventoryComponent* inventory = CreateInventory(testWorld.World);
+	UMounteaCraftingParticipantComponent* participant = CreateParticipant(inventory);
+	UMounteaCraftingStationComponent* station = CreateCraftingStation(testWorld.World);
+	if (!TestNotNull(TEXT("Participant"), participant) || !TestNotNull(TEXT("Station"), station))
+		return false;
+
+	TArray<UMounteaInventoryItemTemplate*> templates;
+	UMounteaRecipeTemplate* recipe = MounteaInventoryAutomationTests::CreateCraftingRecipe(templates);
+	UMounteaRecipeIngredientsList* ingredients = recipe->RecipeIngredientOptions[0];
+	UMounteaInventoryItemTemplate* resultTemplate = templates.Last();
+	MounteaInventoryAutomationTests::AddRecipeIngredients(inventory, recipe, 3);
+
+	const TScriptInterface<IMounteaAdvancedCraftingParticipantInterface> participantInterface = participant;
+	TestFalse(TEXT("Station is not used yet"), UMounteaCraftingStatics::EnqueueCraftingJob(station, participantInterface, recipe, ingredients, 1).IsValid());
+
+	IMounteaAdvancedCraftingParticipantInterface::Execute_LearnRecipe(participant, recipe);
+	TestTrue(TEXT("Participant uses station"), UMounteaCraftingStatics::StartUsingCraftingStation(participant, station));
+
+	UMounteaRecipeIngredientsList* foreignIngredients = DuplicateObject(ingredients, GetTransientPackage());
+	TestFalse(TEXT("Ingredients of other recipe are rejected"), UMounteaCraftingStatics::EnqueueCraftingJob(station, participantInterface, recipe, foreignIngredients, 1).IsValid());
+
+	// Timed job waits for its timer, nothing is crafted on enqueue
+	recipe->CraftingTime = 5.f;
+	const FGuid timedJob = UMounteaCraftingStatics::EnqueueCraftingJob(station, participantInterface, recipe, ingredients, 2);
+	TestTrue(TEXT("Timed job is enqueued"), timedJob.IsValid());
+	TestEqual(TEXT("Timed job is queued"), UMounteaCraftingStatics::GetCraftingJobs(station).Num(), 1);
+	TestEqual(TEXT("Timed job did not progress"), UMounteaCraftingStatics::GetCraftingJobProgress(station, timedJob), 0.f);
+	TestEqual(TEXT("Timed job did not craft"), GetTemplateQuantity(inventory, resultTemplate), 0);
+
+	TestTrue(TEXT("Timed job is cancelled"), UMounteaCraftingStatics::CancelCraftingJob(station, timedJob));
+	TestEqual(TEXT("Cancelled job is removed"), UMounteaCraftingStatics::GetCraftingJobs(station).Num(), 0);
+	TestFalse(TEXT("Cancelled job cannot be cancelled again"), UMounteaCraftingStatics::CancelCraftingJob(station, timedJob));
+
+	// Instant job finishes all its units while being enqueued
+	recipe->CraftingTime = 0.f;
+	TestTrue(TEXT("Instant job is enqueued"), UMounteaCraftingStatics::EnqueueCraftingJob(station, participantInterface, recipe, ingredients, 2).IsValid());
+	TestEqual(TEXT("Instant job is finished"), UMounteaCraftingStatics::GetCraftingJobs(station).Num(), 0);
+	TestEqual(TEXT("Instant job crafted every unit"), GetTemplateQuantity(inventory, resultTemplate), 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaLoadoutSeededQuantitiesTest, "Mountea.Inventory.Loadout.SeededQuantities", MounteaInventoryAutomationTests::TestFlags)
+
+bool FMounteaLoadoutSeededQuantitiesTest::RunTest(const FString& Parameters)
+{
+	const TArray<UMounteaInventoryItemTemplate*> templates = MounteaInventoryTestUtilities::CreateSyntheticTemplates(16);
+
+	TArray<UMounteaAdvancedInventoryLoadoutItem*> loadoutItems;
+	for (UMounteaInventoryItemTemplate* itemTemplate : templates)
+	{
+		UMounteaAdvancedInventoryLoadoutItem* loadoutItem = NewObject<UMounteaAdvancedInventoryLoadoutItem>(GetTransientPackage(), NAME_None, RF_Transient);
+		loadoutItem->ItemTemplate = itemTemplate;
+		loadoutItem->bUseRandomQuantity = true;
+		loadoutItem->RandomRange = FIntPoint(1, 100);
+		loadoutItems.Add(loadoutItem);
+	}
+
+	// Fixed quantity items must not consume random values of the following ones
+	const TArray<UMounteaAdvancedInventoryLoadoutItem*> randomItems(loadoutItems.GetData() + 2, loadoutItems.Num() - 2);
+	const TArray<int32> randomOnlyQuantities = UMounteaLoadoutStatics::ResolveLoadoutQuantities(randomItems, 1234);
+
+	loadoutItems[0]->bUseRandomQuantity = false;
+	loadoutItems[0]->BaseQuantity = 7;
+	loadoutItems[1]->bUseRandomQuantity = false;
+	loadoutItems[1]->BaseQuantity = 3;
+
+	const TArray<int32> firstQuantities = UMounteaLoadoutStatics::ResolveLoadoutQuantities(loadoutItems, 1234);
+	const TArray<int32> repeatedQuantities = UMounteaLoadoutStatics::ResolveLoadoutQuantities(loadoutItems, 1234);
+	const TArray<int32> otherQuantities = UMounteaLoadoutStatics::ResolveLoadoutQuantities(loadoutItems, 4321);
+
+	if (!TestEqual(TEXT("Quantity per item"), firstQuantities.Num(), loadoutItems.Num()))
+		return false;
+
+	TestTrue(TEXT("Same seed resolves same quantities"), firstQuantities == repeatedQuantities);
+	TestFalse(TEXT("Different seed resolves different quantities"), firstQuantities == otherQuantities);
+	TestEqual(TEXT("Fixed quantity"), firstQuantities[0], 7);
+	TestEqual(TEXT("Second fixed quantity"), firstQuantities[1], 3);
+	TestTrue(TEXT("Fixed quantities do not consume random values"),
+		TArray<int32>(firstQuantities.GetData() + 2, firstQuantities.Num() - 2) == randomOnlyQuantities);
+	for (int32 i = 2; i < firstQuantities.Num(); ++i)
+	{
+		if (!TestTrue(TEXT("Random quantity is within range"), firstQuantities[i] >= 1 && firstQuantities[i] <= 100))
+			break;
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,23 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Tests/MounteaInventoryTestPackageMap.h"
+
+bool UMounteaInventoryTestPackageMap::SerializeObject(FArchive& Ar, UClass* InClass, UObject*& Obj, FNetworkGUID* OutNetGUID)
+{
+	FString objectPath = (Ar.IsSaving() && IsValid(Obj)) ? Obj->GetPathName() : FString();
+	Ar << objectPath;
+
+	if (Ar.IsLoading())
+		Obj = objectPath.IsEmpty() ? nullptr : StaticFindObject(InClass, nullptr, *objectPath);
+
+	return Obj != nullptr || objectPath.IsEmpty();
+}
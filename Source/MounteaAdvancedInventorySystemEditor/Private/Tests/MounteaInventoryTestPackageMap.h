@@ -0,0 +1,32 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/CoreNet.h"
+#include "MounteaInventoryTestPackageMap.generated.h"
+
+/**
+ * Package map resolving objects by path, so net serialization can be round-tripped without a connection.
+ * Objects must stay loaded between writing and reading, which holds for transient test templates.
+ *
+ * @see UMounteaInventoryBenchmarkCommandlet
+ */
+UCLASS(Transient)
+class UMounteaInventoryTestPackageMap : public UPackageMap
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual bool SerializeObject(FArchive& Ar, UClass* InClass, UObject*& Obj, FNetworkGUID* OutNetGUID = nullptr) override;
+};
@@ -0,0 +1,141 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#include "Tests/MounteaInventoryTestUtilities.h"
+
+#include "Components/MounteaCraftingParticipantComponent.h"
+#include "Components/MounteaCraftingStationComponent.h"
+#include "Components/MounteaInventoryComponent.h"
+#include "Definitions/MounteaInventoryItemTemplate.h"
+#include "Definitions/MounteaRecipeIngredient.h"
+#include "Definitions/MounteaRecipeIngredientsList.h"
+#include "Definitions/MounteaRecipeTemplate.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Interfaces/Crafting/MounteaAdvancedCraftingParticipantInterface.h"
+#include "Interfaces/Inventory/MounteaAdvancedInventoryInterface.h"
+
+namespace MounteaInventoryTestUtilities
+{
+	const TCHAR* const Categories[4] = { TEXT("Weapons"), TEXT("Armor"), TEXT("Consumables"), TEXT("Materials") };
+	const TCHAR* const Rarities[4] = { TEXT("Common"), TEXT("Uncommon"), TEXT("Rare"), TEXT("Epic") };
+
+	FScopedTestWorld::FScopedTestWorld(const TCHAR* WorldName)
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, WorldName);
+	}
+
+	FScopedTestWorld::~FScopedTestWorld()
+	{
+		if (IsValid(World))
+			World->DestroyWorld(false);
+	}
+
+	TArray<UMounteaInventoryItemTemplate*> CreateSyntheticTemplates(const int32 Count)
+	{
+		TArray<UMounteaInventoryItemTemplate*> returnValue;
+		returnValue.Reserve(Count);
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			UMounteaInventoryItemTemplate* newTemplate = NewObject<UMounteaInventoryItemTemplate>(GetTransientPackage(), NAME_None, RF_Transient);
+			newTemplate->Guid = FGuid::NewGuid();
+			newTemplate->DisplayName = FText::FromString(FString::Printf(TEXT("Synthetic Item %06d"), (i * 7919) % Count));
+			newTemplate->ItemCategory = Categories[i % UE_ARRAY_COUNT(Categories)];
+			newTemplate->ItemRarity = Rarities[(i / 3) % UE_ARRAY_COUNT(Rarities)];
+			newTemplate->MaxQuantity = 999;
+			newTemplate->MaxStackSize = 999;
+			newTemplate->bHasDurability = (i % 2) == 0;
+			newTemplate->MaxDurability = 1.f;
+			newTemplate->BaseDurability = 1.f;
+			newTemplate->bHasPrice = true;
+			newTemplate->BasePrice = static_cast<float>((i * 31) % 997);
+			newTemplate->bHasWeight = true;
+			newTemplate->Weight = 0.1f + (i % 10);
+			returnValue.Add(newTemplate);
+		}
+
+		return returnValue;
+	}
+
+	TArray<UMounteaRecipeTemplate*> CreateSyntheticRecipes(const TArray<UMounteaInventoryItemTemplate*>& Templates, const int32 Count)
+	{
+		TArray<UMounteaRecipeTemplate*> returnValue;
+		if (Templates.Num() == 0)
+			return returnValue;
+
+		returnValue.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			UMounteaRecipeTemplate* newRecipe = NewObject<UMounteaRecipeTemplate>(GetTransientPackage(), NAME_None, RF_Transient);
+			newRecipe->RecipeGuid = FGuid::NewGuid();
+			newRecipe->ResultItem = Templates[i % Templates.Num()];
+			newRecipe->RefreshResultMetadata();
+
+			UMounteaRecipeIngredientsList* ingredientsList = NewObject<UMounteaRecipeIngredientsList>(newRecipe);
+			for (int32 ingredientIndex = 0; ingredientIndex < 3; ++ingredientIndex)
+			{
+				UMounteaRecipeIngredient* ingredient = NewObject<UMounteaRecipeIngredient>(ingredientsList);
+				ingredient->IngredientSource = Templates[(i + ingredientIndex * 13) % Templates.Num()];
+				ingredient->RequiredQuantity = 1;
+				ingredientsList->RecipeIngredients.Add(ingredient);
+			}
+
+			newRecipe->RecipeIngredientOptions.Add(ingredientsList);
+			returnValue.Add(newRecipe);
+		}
+
+		return returnValue;
+	}
+
+	UMounteaInventoryComponent* CreateInventory(UWorld* World)
+	{
+		if (!IsValid(World))
+			return nullptr;
+
+		AActor* inventoryOwner = World->SpawnActor<AActor>();
+		if (!IsValid(inventoryOwner))
+			return nullptr;
+
+		UMounteaInventoryComponent* inventoryComponent = NewObject<UMounteaInventoryComponent>(inventoryOwner);
+		inventoryComponent->RegisterComponent();
+		inventoryComponent->Activate(true);
+		return inventoryComponent;
+	}
+
+	UMounteaCraftingParticipantComponent* CreateParticipant(UMounteaInventoryComponent* Inventory)
+	{
+		AActor* participantOwner = IsValid(Inventory) ? Inventory->GetOwner() : nullptr;
+		if (!IsValid(participantOwner))
+			return nullptr;
+
+		UMounteaCraftingParticipantComponent* participantComponent = NewObject<UMounteaCraftingParticipantComponent>(participantOwner);
+		participantComponent->RegisterComponent();
+		participantComponent->Activate(true);
+		IMounteaAdvancedCraftingParticipantInterface::Execute_SetParentInventory(participantComponent, TScriptInterface<IMounteaAdvancedInventoryInterface>(Inventory));
+		return participantComponent;
+	}
+
+	UMounteaCraftingStationComponent* CreateCraftingStation(UWorld* World)
+	{
+		if (!IsValid(World))
+			return nullptr;
+
+		AActor* stationOwner = World->SpawnActor<AActor>();
+		if (!IsValid(stationOwner))
+			return nullptr;
+
+		UMounteaCraftingStationComponent* stationComponent = NewObject<UMounteaCraftingStationComponent>(stationOwner);
+		stationComponent->RegisterComponent();
+		stationComponent->Activate(true);
+		return stationComponent;
+	}
+}
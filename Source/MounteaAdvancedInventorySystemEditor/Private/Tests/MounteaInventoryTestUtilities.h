@@ -0,0 +1,62 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UMounteaCraftingParticipantComponent;
+class UMounteaCraftingStationComponent;
+class UMounteaInventoryComponent;
+class UMounteaInventoryItemTemplate;
+class UMounteaRecipeTemplate;
+class UWorld;
+
+/**
+ * Synthetic data and transient world shared by the inventory benchmark commandlet and automation tests.
+ */
+namespace MounteaInventoryTestUtilities
+{
+	/** Categories assigned to synthetic templates in round-robin order. */
+	extern const TCHAR* const Categories[4];
+
+	/** Rarities assigned to synthetic templates, one rarity per three templates. */
+	extern const TCHAR* const Rarities[4];
+
+	/** Transient game world, destroyed when going out of scope. */
+	struct FScopedTestWorld
+	{
+		explicit FScopedTestWorld(const TCHAR* WorldName);
+		~FScopedTestWorld();
+
+		UWorld* World = nullptr;
+	};
+
+	/**
+	 * Creates transient item templates with deterministic category, rarity, price and weight distribution.
+	 * Every other template has durability and all of them stack up to 999.
+	 */
+	TArray<UMounteaInventoryItemTemplate*> CreateSyntheticTemplates(const int32 Count);
+
+	/**
+	 * Creates transient recipes, each with single ingredient option of three different templates, one of each required.
+	 */
+	TArray<UMounteaRecipeTemplate*> CreateSyntheticRecipes(const TArray<UMounteaInventoryItemTemplate*>& Templates, const int32 Count);
+
+	/** Spawns actor owning active inventory component. */
+	UMounteaInventoryComponent* CreateInventory(UWorld* World);
+
+	/** Adds crafting participant to the inventory owner and uses the inventory as its parent. */
+	UMounteaCraftingParticipantComponent* CreateParticipant(UMounteaInventoryComponent* Inventory);
+
+	/** Spawns actor owning crafting station component. */
+	UMounteaCraftingStationComponent* CreateCraftingStation(UWorld* World);
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2025 Dominik (Pavlicek) Morse. All rights reserved.
+//
+// Developed for the Mountea Framework as a free tool. This solution is provided
+// for use and sharing without charge. Redistribution is allowed under the following conditions:
+//
+// - You may use this solution in commercial products, provided the product is not
+//   this solution itself (or unless significant modifications have been made to the solution).
+// - You may not resell or redistribute the original, unmodified solution.
+//
+// For more information, visit: https://mountea.tools
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MounteaInventoryBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless benchmark and sanity check for core inventory operations.
+ * Builds synthetic item templates and recipes, fills a transient inventory and reports per-operation timings
+ * together with basic correctness checks. Returns non-zero when any check fails.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd <Project>.uproject -run=MounteaInventoryBenchmark [-Sizes=10,1000,50000] [-Iterations=5]
+ */
+UCLASS()
+class MOUNTEAADVANCEDINVENTORYSYSTEMEDITOR_API UMounteaInventoryBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaInventoryBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+
+	bool RunBenchmark(UWorld* World, const int32 ItemCount, const int32 Iterations) const;
+};